@@ -223,6 +223,45 @@ extern "C" {
  */
 #define SDL_HINT_VIDEO_X11_NET_WM_BYPASS_COMPOSITOR "SDL_VIDEO_X11_NET_WM_BYPASS_COMPOSITOR"
 
+/**
+ *  \brief  A variable controlling how many MIT-SHM images back an X11 window surface.
+ *
+ *  This variable can be set to the following values:
+ *    "1"       - Draw into a single image and wait for the X server to copy it on every update
+ *    "2", "3"  - Rotate between this many images, so the next frame can be drawn while the X server copies the last one
+ *
+ *  By default SDL uses a single image. With more than one, the surface
+ *  pixels pointer changes on every SDL_UpdateWindowSurface() call, and only
+ *  the areas passed to SDL_UpdateWindowSurfaceRects() are carried over to
+ *  the next image, so pixels drawn but never updated may be lost.
+ *  The hint is checked in SDL_GetWindowSurface().
+ */
+#define SDL_HINT_VIDEO_X11_SHM_BUFFERS      "SDL_VIDEO_X11_SHM_BUFFERS"
+
+/**
+ *  \brief  A variable setting the pixel format of window surfaces in the offscreen video driver.
+ *
+ *  The value is a pixel format name, with or without the "SDL_PIXELFORMAT_"
+ *  prefix, for example "ARGB8888". Packed RGB formats of 15 to 32 bits are
+ *  supported.
+ *
+ *  By default the offscreen driver uses RGB888.
+ *  The hint is checked when the video subsystem is initialized and whenever a
+ *  window surface is created.
+ */
+#define SDL_HINT_VIDEO_OFFSCREEN_FORMAT     "SDL_VIDEO_OFFSCREEN_FORMAT"
+
+/**
+ *  \brief  A variable setting the size of the display in the offscreen video driver.
+ *
+ *  The value is "<width>x<height>", for example "1920x1080". Fullscreen
+ *  windows get surfaces of this size.
+ *
+ *  By default the offscreen display is 1024x768.
+ *  The hint is checked when the video subsystem is initialized.
+ */
+#define SDL_HINT_VIDEO_OFFSCREEN_DISPLAY_SIZE "SDL_VIDEO_OFFSCREEN_DISPLAY_SIZE"
+
 /**
  *  \brief  A variable controlling whether the window frame and title bar are interactive when the cursor is hidden 
  *
@@ -1086,6 +1125,65 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
+/**
+ *  \brief  A variable controlling whether the render API logs how well draw calls are being batched.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Don't log anything (default).
+ *    "1"     - Each time the render command queue is flushed, log how many
+ *              queued commands there were and how many remained after
+ *              adjacent compatible commands were merged.
+ *
+ *  Renderers that draw a run of points, rects or copies that share the same
+ *  texture, color and blend mode as a single command merge them before
+ *  drawing. This is meant as a debugging aid for checking that an app's draw
+ *  order lets that happen.
+ */
+#define SDL_HINT_RENDER_LOG_COALESCING  "SDL_RENDER_LOG_COALESCING"
+
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Draw everything on the thread that flushes the render queue (default).
+ *    "N"        - Split the target into tiles and draw them on N threads, including
+ *                 the thread that flushes the render queue.
+ *
+ *  The output is identical either way. Points, rectangles, unscaled copies and
+ *  geometry are drawn in parallel; lines, scaled and rotated copies are drawn on
+ *  the flushing thread in between. SDL_GetCPUCount() is a reasonable value.
+ *
+ *  This hint is checked when the software renderer is created.
+ */
+#define SDL_HINT_RENDER_SW_THREADS  "SDL_RENDER_SW_THREADS"
+
+/**
+ *  \brief  A variable controlling how many threads large software blits are split across.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0" or "1" - Blit on the calling thread (default).
+ *    "N"        - Split blits into bands of rows and run them on N threads,
+ *                 including the calling thread.
+ *
+ *  This covers SDL_BlitSurface(), SDL_BlitScaled(), SDL_ConvertSurface() and
+ *  YUV to RGB conversion in SDL_ConvertPixels() and software YUV textures, for
+ *  blits of at least SDL_HINT_BLIT_THREAD_THRESHOLD pixels, and the output is
+ *  identical either way. Scaled blits that also blend, modulate or convert the
+ *  pixel format stay on the calling thread. Only one blit at a time is split,
+ *  blits made while the worker threads are busy run on their calling thread.
+ */
+#define SDL_HINT_BLIT_THREADS  "SDL_BLIT_THREADS"
+
+/**
+ *  \brief  A variable controlling the smallest blit that SDL_HINT_BLIT_THREADS splits.
+ *
+ *  This variable is a number of destination pixels, the default is 262144 (512x512).
+ */
+#define SDL_HINT_BLIT_THREAD_THRESHOLD  "SDL_BLIT_THREAD_THRESHOLD"
+
 
 /**
  *  \brief  An enumeration of hint priorities
@@ -50,6 +50,7 @@
 
 #include "SDL_stdinc.h"
 #include "SDL_rect.h"
+#include "SDL_rwops.h"
 #include "SDL_video.h"
 
 #include "begin_code.h"
@@ -115,6 +116,47 @@ typedef enum
     SDL_FLIP_VERTICAL = 0x00000002     /**< flip vertically */
 } SDL_RendererFlip;
 
+/**
+ *  \brief Vertex structure for SDL_RenderGeometry()
+ */
+typedef struct SDL_Vertex
+{
+    SDL_FPoint position;        /**< Vertex position, in SDL_Renderer coordinates  */
+    SDL_Color  color;           /**< Vertex color */
+    SDL_FPoint tex_coord;       /**< Normalized texture coordinates, if needed */
+} SDL_Vertex;
+
+/**
+ *  \brief One textured rectangle for SDL_RenderCopyBatch()
+ */
+typedef struct SDL_RenderCopyItem
+{
+    SDL_Rect srcrect;           /**< Area of the texture to copy, or an empty rect for all of it */
+    SDL_FRect dstrect;          /**< Destination, in SDL_Renderer coordinates */
+    double angle;               /**< Clockwise rotation in degrees around center */
+    SDL_FPoint center;          /**< Rotation center, relative to the top left of dstrect */
+    SDL_RendererFlip flip;      /**< Flipping to apply before rotating */
+    SDL_Color color;            /**< Multiplied with the texture's color and alpha modulation */
+} SDL_RenderCopyItem;
+
+/**
+ *  \brief Counters describing the work a renderer did for one frame.
+ *
+ *  \sa SDL_RenderGetStats()
+ */
+typedef struct SDL_RenderStats
+{
+    Uint32 commands_queued;     /**< Render commands queued by API calls */
+    Uint32 commands_executed;   /**< Render commands sent to the backend, after batching */
+    Uint32 flushes;             /**< Times the command queue was sent to the backend */
+    Uint32 texture_flushes;     /**< Flushes forced by changing a texture the queue used */
+    Uint32 unbatched_flushes;   /**< Flushes forced because batching is disabled */
+    Uint64 vertex_bytes;        /**< Bytes of vertex data sent to the backend */
+    Uint32 texture_uploads;     /**< Texture updates and unlocks */
+    Uint64 texture_upload_bytes;/**< Bytes of pixel data uploaded to textures */
+    Uint32 target_switches;     /**< Render target changes */
+} SDL_RenderStats;
+
 /**
  *  \brief A structure representing rendering state
  */
@@ -127,6 +169,14 @@ typedef struct SDL_Renderer SDL_Renderer;
 struct SDL_Texture;
 typedef struct SDL_Texture SDL_Texture;
 
+/**
+ *  \brief A recorded, replayable sequence of render commands
+ *
+ *  \sa SDL_RenderBeginCommandList()
+ */
+struct SDL_RenderCommandList;
+typedef struct SDL_RenderCommandList SDL_RenderCommandList;
+
 
 /* Function prototypes */
 
@@ -977,6 +1027,50 @@ extern DECLSPEC int SDLCALL SDL_RenderCopyExF(SDL_Renderer * renderer,
                                             const SDL_FPoint *center,
                                             const SDL_RendererFlip flip);
 
+/**
+ *  \brief Copy many portions of one texture to the current rendering target.
+ *
+ *  \param renderer The renderer which should copy parts of a texture.
+ *  \param texture The source texture.
+ *  \param items   The copies to make, in drawing order.
+ *  \param count   The number of items.
+ *
+ *  This draws the same as calling SDL_RenderCopyExF() for each item, with
+ *  the item's color applied on top of the texture's color and alpha
+ *  modulation, but validates the arguments and draw state once for the
+ *  whole array.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyBatch(SDL_Renderer * renderer,
+                                                SDL_Texture * texture,
+                                                const SDL_RenderCopyItem * items,
+                                                int count);
+
+/**
+ *  \brief Render a list of triangles, optionally using a texture and indices into the vertex array.
+ *
+ *  \param renderer The renderer which should draw the triangles.
+ *  \param texture (optional) The SDL texture to use.
+ *  \param vertices Vertices.
+ *  \param num_vertices Number of vertices.
+ *  \param indices (optional) An array of integer indices into the 'vertices' array, if NULL all vertices will be rendered in sequential order.
+ *  \param num_indices Number of indices.
+ *
+ *  Every three vertices (or indices) make one triangle. The vertex colors are
+ *  interpolated across each triangle and modulate the texture, if any. The
+ *  texture color and alpha modulation are applied on top of them. The blend
+ *  mode is the texture blend mode, or the draw blend mode without a texture.
+ *
+ *  \return 0 on success, or -1 if the operation is not supported
+ *
+ *  \sa SDL_Vertex
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGeometry(SDL_Renderer * renderer,
+                                               SDL_Texture * texture,
+                                               const SDL_Vertex * vertices, int num_vertices,
+                                               const int * indices, int num_indices);
+
 /**
  *  \brief Read pixels from the current rendering target.
  *
@@ -1043,6 +1137,134 @@ extern DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer * renderer);
  */
 extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
 
+/**
+ *  \brief Get counters describing the work done for the last frame.
+ *
+ *  \param renderer The renderer to query.
+ *  \param stats    A pointer filled in with the counters for the frame that
+ *                  ended with the most recent SDL_RenderPresent() call.
+ *
+ *  The counters are always kept, so this can be used to find frames that
+ *  defeat batching (many flushes, few commands per flush) in production.
+ *  Everything is zero until the first SDL_RenderPresent().
+ *
+ *  \return 0 on success, or -1 on error
+ *
+ *  \sa SDL_RenderStats
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats * stats);
+
+/**
+ *  \brief Start recording rendering calls into a command list.
+ *
+ *  \param renderer The renderer to record.
+ *
+ *  Any pending rendering is flushed first. Until SDL_RenderEndCommandList()
+ *  is called, the drawing functions queue their commands into the list
+ *  instead of drawing them. The draw color, viewport and clip rectangle in
+ *  effect for each call are recorded along with it.
+ *
+ *  While recording, SDL_SetRenderTarget() and SDL_RenderReadPixels() fail,
+ *  and SDL_RenderPresent() does not draw the recorded commands.
+ *
+ *  \return 0 on success, or -1 if the renderer can't record command lists or
+ *          is already recording one.
+ *
+ *  \sa SDL_RenderEndCommandList()
+ *  \sa SDL_RenderReplayCommandList()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderBeginCommandList(SDL_Renderer * renderer);
+
+/**
+ *  \brief Finish recording a command list.
+ *
+ *  \param renderer The renderer being recorded.
+ *
+ *  \return The recorded command list, or NULL on error. It owns a copy of its
+ *          vertex data and can be replayed any number of times.
+ *
+ *  \sa SDL_RenderBeginCommandList()
+ *  \sa SDL_DestroyRenderCommandList()
+ */
+extern DECLSPEC SDL_RenderCommandList * SDLCALL SDL_RenderEndCommandList(SDL_Renderer * renderer);
+
+/**
+ *  \brief Queue the commands of a recorded command list for drawing.
+ *
+ *  \param renderer The renderer the list was recorded on.
+ *  \param list     The command list to replay.
+ *  \param dx       The horizontal offset to draw the list at.
+ *  \param dy       The vertical offset to draw the list at.
+ *
+ *  The offset moves everything the list draws, but not the viewport or clip
+ *  rectangle the list was recorded with. Textures used by the list are drawn
+ *  with their contents and modulation at the time of drawing, and must not be
+ *  destroyed while the list can still be replayed.
+ *
+ *  \return 0 on success, or -1 on error
+ */
+extern DECLSPEC int SDLCALL SDL_RenderReplayCommandList(SDL_Renderer * renderer,
+                                                        const SDL_RenderCommandList * list,
+                                                        int dx, int dy);
+
+/**
+ *  \brief Destroy a command list.
+ *
+ *  \sa SDL_RenderEndCommandList()
+ */
+extern DECLSPEC void SDLCALL SDL_DestroyRenderCommandList(SDL_RenderCommandList * list);
+
+/**
+ *  \brief The output formats for captured frames.
+ *
+ *  \sa SDL_RenderStartCapture()
+ */
+typedef enum
+{
+    SDL_RENDERCAPTURE_RAW,      /**< Headerless ARGB8888 frames, back to back */
+    SDL_RENDERCAPTURE_PPM,      /**< A binary PPM (P6) image per frame */
+    SDL_RENDERCAPTURE_Y4M       /**< A YUV4MPEG2 4:2:0 video stream */
+} SDL_RenderCaptureFormat;
+
+/**
+ *  \brief Start writing every presented frame to a stream.
+ *
+ *  \param renderer    The renderer to capture.
+ *  \param dst         The stream to write the frames to.
+ *  \param freedst     Non-zero to close the stream when the capture stops.
+ *  \param format      The format to write the frames in.
+ *  \param num_buffers The number of frames that can be waiting to be written.
+ *
+ *  SDL_RenderPresent() reads the frame back into a free buffer and returns,
+ *  the frames are converted and written by a separate thread. If all of the
+ *  buffers are waiting to be written, SDL_RenderPresent() waits for one, so
+ *  no frames are dropped.
+ *
+ *  Frames presented while a render target is set are not captured. The raw
+ *  and Y4M streams have the size of the first captured frame, and frames of
+ *  another size are skipped.
+ *
+ *  \return 0 on success, or -1 if the renderer is already being captured or
+ *          the capture couldn't be started. If this fails and \c freedst is
+ *          non-zero, the stream is not closed.
+ *
+ *  \sa SDL_RenderStopCapture()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderStartCapture(SDL_Renderer * renderer,
+                                                   SDL_RWops * dst, int freedst,
+                                                   SDL_RenderCaptureFormat format,
+                                                   int num_buffers);
+
+/**
+ *  \brief Stop capturing frames, waiting until the captured frames are written.
+ *
+ *  \return 0 on success, or -1 if the renderer wasn't being captured or some
+ *          of the frames couldn't be written.
+ *
+ *  \sa SDL_RenderStartCapture()
+ */
+extern DECLSPEC int SDLCALL SDL_RenderStopCapture(SDL_Renderer * renderer);
+
 
 /**
  *  \brief Bind the texture to the current OpenGL/ES/ES2 context for use with
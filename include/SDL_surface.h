@@ -54,6 +54,8 @@ extern "C" {
 #define SDL_RLEACCEL        0x00000002  /**< Surface is RLE encoded */
 #define SDL_DONTFREE        0x00000004  /**< Surface is referenced internally */
 #define SDL_SIMD_ALIGNED    0x00000008  /**< Surface uses aligned memory */
+#define SDL_MAPPED          0x00000010  /**< Surface pixels are in a memory mapped file */
+#define SDL_POOLED          0x00000020  /**< Surface is recycled by the surface pool */
 /* @} *//* Surface flags */
 
 /**
@@ -118,7 +120,8 @@ typedef enum
  *
  *  If the function runs out of memory, it will return NULL.
  *
- *  \param flags The \c flags are obsolete and should be set to 0.
+ *  \param flags 0, or ::SDL_POOLED to recycle the surface, see
+ *               SDL_SetSurfacePoolSize().
  *  \param width The width in pixels of the surface to create.
  *  \param height The height in pixels of the surface to create.
  *  \param depth The depth in bits of the surface to create.
@@ -148,6 +151,41 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_CreateRGBSurfaceWithFormatFrom
     (void *pixels, int width, int height, int depth, int pitch, Uint32 format);
 extern DECLSPEC void SDLCALL SDL_FreeSurface(SDL_Surface * surface);
 
+/**
+ *  \brief Statistics of the surface pool, see SDL_GetSurfacePoolStats().
+ */
+typedef struct SDL_SurfacePoolStats
+{
+    int surfaces;           /**< Number of free surfaces in the pool */
+    size_t bytes;           /**< Pixel memory held by those surfaces */
+    size_t max_bytes;       /**< The size set with SDL_SetSurfacePoolSize() */
+    Uint32 hits;            /**< ::SDL_POOLED surfaces that were recycled */
+    Uint32 misses;          /**< ::SDL_POOLED surfaces that were allocated */
+    Uint32 evictions;       /**< Surfaces freed to keep the pool in its size */
+} SDL_SurfacePoolStats;
+
+/**
+ *  \brief Set how much pixel memory the surface pool may hold.
+ *
+ *  Surfaces created with the ::SDL_POOLED flag aren't freed by
+ *  SDL_FreeSurface(), they are kept in a pool and handed out again by the
+ *  next SDL_CreateRGBSurface() call for a surface of the same size and
+ *  format. A recycled surface is reset as if it was new, including clearing
+ *  the pixels. SDL also uses the pool for its own temporary surfaces in
+ *  software rendering and scaled blits. Surfaces returned by SDL are only
+ *  pooled if you passed ::SDL_POOLED when creating or converting them.
+ *
+ *  When the pool holds more than \c max_bytes of pixels the surfaces that
+ *  were freed first are released. 0 empties the pool and turns it off.
+ *  The default size is 32 MB.
+ */
+extern DECLSPEC void SDLCALL SDL_SetSurfacePoolSize(size_t max_bytes);
+
+/**
+ *  \brief Get the current state of the surface pool.
+ */
+extern DECLSPEC void SDLCALL SDL_GetSurfacePoolStats(SDL_SurfacePoolStats * stats);
+
 /**
  *  \brief Set the palette used by a surface.
  *
@@ -200,6 +238,21 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadBMP_RW(SDL_RWops * src,
  */
 #define SDL_LoadBMP(file)   SDL_LoadBMP_RW(SDL_RWFromFile(file, "rb"), 1)
 
+/**
+ *  Load a surface from a file by memory mapping it.
+ *
+ *  If the pixels are stored top-down in a format SDL can use as-is, the
+ *  surface pixels point into the mapping and the ::SDL_MAPPED flag is set.
+ *  The mapping is private, changes to the pixels are never written to the
+ *  file, and it is released by SDL_FreeSurface(). A 32-bit image without
+ *  any alpha data gets a format without an alpha channel rather than having
+ *  its alpha set to opaque. Other files are decoded straight from the
+ *  mapping, or read with SDL_LoadBMP() if the file can't be mapped.
+ *
+ *  \return the new surface, or NULL if there was an error.
+ */
+extern DECLSPEC SDL_Surface *SDLCALL SDL_LoadBMP_Mapped(const char *file);
+
 /**
  *  Save a surface to a seekable SDL data stream (memory or file).
  *
@@ -409,6 +462,23 @@ extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
                                               Uint32 dst_format,
                                               void * dst, int dst_pitch);
 
+/**
+ * \brief Premultiply the alpha on a block of pixels
+ *
+ *  The pixels are converted to \c dst_format first if needed, which must be
+ *  a 32-bit format with an 8-bit alpha channel. The result is meant to be
+ *  drawn with ::SDL_BLENDMODE_BLEND_PREMULTIPLIED.
+ *
+ *  This is safe to use with src == dst, but not for other overlapping areas.
+ *
+ *  \return 0 on success, or -1 if there was an error
+ */
+extern DECLSPEC int SDLCALL SDL_PremultiplyAlpha(int width, int height,
+                                                 Uint32 src_format,
+                                                 const void * src, int src_pitch,
+                                                 Uint32 dst_format,
+                                                 void * dst, int dst_pitch);
+
 /**
  *  Performs a fast fill of the given rectangle with \c color.
  *
@@ -857,6 +857,10 @@ extern DECLSPEC int SDLCALL SDL_UpdateWindowSurface(SDL_Window * window);
 /**
  *  \brief Copy a number of rectangles on the window surface to the screen.
  *
+ *  The rectangles may overlap. They are clipped to the surface and merged
+ *  into a few disjoint rectangles, which may cover a little more than the
+ *  original ones, before they are copied.
+ *
  *  \return 0 on success, or -1 on error.
  *
  *  \sa SDL_GetWindowSurface()
@@ -1081,6 +1085,46 @@ extern DECLSPEC int SDLCALL SDL_SetWindowHitTest(SDL_Window * window,
                                                  SDL_HitTest callback,
                                                  void *callback_data);
 
+/**
+ *  \brief Callback used to watch the frames presented to a window surface.
+ *
+ *  \param window   The window that was updated.
+ *  \param frame    The window surface, holding the presented frame. It is
+ *                  only valid during the callback.
+ *  \param rects    The areas of the surface that were updated, disjoint
+ *                  and clipped to the surface.
+ *  \param numrects The number of rectangles.
+ *  \param data     The pointer passed to SDL_SetWindowFrameCallback().
+ *
+ *  \sa SDL_SetWindowFrameCallback
+ */
+typedef void (SDLCALL *SDL_WindowFrameCallback)(SDL_Window *window,
+                                                SDL_Surface *frame,
+                                                const SDL_Rect *rects,
+                                                int numrects,
+                                                void *data);
+
+/**
+ *  \brief Provide a callback that sees every frame presented to a window surface.
+ *
+ *  The callback runs from SDL_UpdateWindowSurface() and
+ *  SDL_UpdateWindowSurfaceRects(), after the frame has been handed to the
+ *  video driver, so it also sees the frames of the software renderer. This is
+ *  meant for capturing output from test and benchmark runs, typically with
+ *  the "offscreen" video driver, without reading the frames back or writing
+ *  them to disk.
+ *
+ *  Specifying NULL for a callback removes it.
+ *
+ *  \param window The window to watch.
+ *  \param callback The callback to call after each update.
+ *  \param callback_data An app-defined void pointer passed to the callback.
+ *  \return 0 on success, -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SetWindowFrameCallback(SDL_Window * window,
+                                                       SDL_WindowFrameCallback callback,
+                                                       void *callback_data);
+
 /**
  *  \brief Destroy a window.
  */
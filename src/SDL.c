@@ -34,6 +34,9 @@
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
 #include "sensor/SDL_sensor_c.h"
+#include "video/SDL_blit.h"
+#include "video/SDL_blit_threads.h"
+#include "video/SDL_surfacepool_c.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -387,6 +390,8 @@ SDL_Quit(void)
     SDL_TicksQuit();
 #endif
 
+    SDL_QuitBlitThreads();
+    SDL_QuitSurfacePool();
     SDL_ClearHints();
     SDL_AssertionsQuit();
     SDL_LogResetPriorities();
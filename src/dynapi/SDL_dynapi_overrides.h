@@ -713,3 +713,17 @@
 #define SDL_RenderCopyF SDL_RenderCopyF_REAL
 #define SDL_RenderCopyExF SDL_RenderCopyExF_REAL
 #define SDL_GetTouchDeviceType SDL_GetTouchDeviceType_REAL
+#define SDL_RenderGeometry SDL_RenderGeometry_REAL
+#define SDL_RenderGetStats SDL_RenderGetStats_REAL
+#define SDL_RenderBeginCommandList SDL_RenderBeginCommandList_REAL
+#define SDL_RenderEndCommandList SDL_RenderEndCommandList_REAL
+#define SDL_RenderReplayCommandList SDL_RenderReplayCommandList_REAL
+#define SDL_DestroyRenderCommandList SDL_DestroyRenderCommandList_REAL
+#define SDL_RenderCopyBatch SDL_RenderCopyBatch_REAL
+#define SDL_SetWindowFrameCallback SDL_SetWindowFrameCallback_REAL
+#define SDL_PremultiplyAlpha SDL_PremultiplyAlpha_REAL
+#define SDL_LoadBMP_Mapped SDL_LoadBMP_Mapped_REAL
+#define SDL_RenderStartCapture SDL_RenderStartCapture_REAL
+#define SDL_RenderStopCapture SDL_RenderStopCapture_REAL
+#define SDL_SetSurfacePoolSize SDL_SetSurfacePoolSize_REAL
+#define SDL_GetSurfacePoolStats SDL_GetSurfacePoolStats_REAL
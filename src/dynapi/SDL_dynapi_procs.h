@@ -767,3 +767,17 @@ SDL_DYNAPI_PROC(int,SDL_RenderFillRectsF,(SDL_Renderer *a, const SDL_FRect *b, i
 SDL_DYNAPI_PROC(int,SDL_RenderCopyF,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_FRect *d),(a,b,c,d),return)
 SDL_DYNAPI_PROC(int,SDL_RenderCopyExF,(SDL_Renderer *a, SDL_Texture *b, const SDL_Rect *c, const SDL_FRect *d, const double e, const SDL_FPoint *f, const SDL_RendererFlip g),(a,b,c,d,e,f,g),return)
 SDL_DYNAPI_PROC(SDL_TouchDeviceType,SDL_GetTouchDeviceType,(SDL_TouchID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGeometry,(SDL_Renderer *a, SDL_Texture *b, const SDL_Vertex *c, int d, const int *e, int f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(int,SDL_RenderGetStats,(SDL_Renderer *a, SDL_RenderStats *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_RenderBeginCommandList,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(SDL_RenderCommandList*,SDL_RenderEndCommandList,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderReplayCommandList,(SDL_Renderer *a, const SDL_RenderCommandList *b, int c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyRenderCommandList,(SDL_RenderCommandList *a),(a),)
+SDL_DYNAPI_PROC(int,SDL_RenderCopyBatch,(SDL_Renderer *a, SDL_Texture *b, const SDL_RenderCopyItem *c, int d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(int,SDL_SetWindowFrameCallback,(SDL_Window *a, SDL_WindowFrameCallback b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_PremultiplyAlpha,(int a, int b, Uint32 c, const void *d, int e, Uint32 f, void *g, int h),(a,b,c,d,e,f,g,h),return)
+SDL_DYNAPI_PROC(SDL_Surface*,SDL_LoadBMP_Mapped,(const char *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_RenderStartCapture,(SDL_Renderer *a, SDL_RWops *b, int c, SDL_RenderCaptureFormat d, int e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_RenderStopCapture,(SDL_Renderer *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_SetSurfacePoolSize,(size_t a),(a),)
+SDL_DYNAPI_PROC(void,SDL_GetSurfacePoolStats,(SDL_SurfacePoolStats *a),(a),)
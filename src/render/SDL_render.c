@@ -23,6 +23,7 @@
 /* The SDL 2D rendering system */
 
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
 #include "SDL_hints.h"
 #include "SDL_log.h"
 #include "SDL_render.h"
@@ -72,6 +73,10 @@
     SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_ZERO, SDL_BLENDFACTOR_SRC_COLOR, SDL_BLENDOPERATION_ADD, \
                           SDL_BLENDFACTOR_ZERO, SDL_BLENDFACTOR_ONE, SDL_BLENDOPERATION_ADD)
 
+#define SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL \
+    SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
+                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)
+
 #if !SDL_RENDER_DISABLED
 static const SDL_RenderDriver *render_drivers[] = {
 #if SDL_VIDEO_RENDER_D3D
@@ -104,6 +109,16 @@ static const SDL_RenderDriver *render_drivers[] = {
 
 static char renderer_magic;
 static char texture_magic;
+static SDL_atomic_t renderer_serial;
+
+struct SDL_RenderCommandList
+{
+    Uint32 renderer_serial;
+    SDL_RenderCommand *commands;
+    int num_commands;
+    void *vertices;
+    size_t vertsize;
+};
 
 static SDL_INLINE void
 DebugLogRenderCommands(const SDL_RenderCommand *cmd)
@@ -190,29 +205,92 @@ DebugLogRenderCommands(const SDL_RenderCommand *cmd)
                         (int) cmd->data.draw.b, (int) cmd->data.draw.a,
                         (int) cmd->data.draw.blend, cmd->data.draw.texture);
                 break;
+
+            case SDL_RENDERCMD_GEOMETRY:
+                SDL_Log(" %u. geometry (first=%u, count=%u, r=%d, g=%d, b=%d, a=%d, blend=%d, tex=%p)", i++,
+                        (unsigned int) cmd->data.draw.first,
+                        (unsigned int) cmd->data.draw.count,
+                        (int) cmd->data.draw.r, (int) cmd->data.draw.g,
+                        (int) cmd->data.draw.b, (int) cmd->data.draw.a,
+                        (int) cmd->data.draw.blend, cmd->data.draw.texture);
+                break;
         }
         cmd = cmd->next;
     }
 #endif
 }
 
-static int
-FlushRenderCommands(SDL_Renderer *renderer)
+static SDL_bool
+CanCoalesceRenderCommands(const SDL_RenderCommand *cmd, const SDL_RenderCommand *next)
 {
-    SDL_AllocVertGap *prevgap = &renderer->vertex_data_gaps;
-    SDL_AllocVertGap *gap = prevgap;
-    int retval;
+    if (next->command != cmd->command) {
+        return SDL_FALSE;
+    }
 
-    SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_FILL_RECTS:
+        case SDL_RENDERCMD_COPY:
+            break;
+        default:
+            return SDL_FALSE;  /* lines are strips, the rest don't have a vertex count. */
+    }
 
-    if (renderer->render_commands == NULL) {  /* nothing to do! */
-        SDL_assert(renderer->vertex_data_used == 0);
-        return 0;
+    /* the vertices must pick up exactly where the previous command's stopped. */
+    if (!cmd->data.draw.size || !next->data.draw.size ||
+        (next->data.draw.first != (cmd->data.draw.first + cmd->data.draw.size))) {
+        return SDL_FALSE;
     }
 
-    DebugLogRenderCommands(renderer->render_commands);
+    return ((cmd->data.draw.r == next->data.draw.r) &&
+            (cmd->data.draw.g == next->data.draw.g) &&
+            (cmd->data.draw.b == next->data.draw.b) &&
+            (cmd->data.draw.a == next->data.draw.a) &&
+            (cmd->data.draw.blend == next->data.draw.blend) &&
+            (cmd->data.draw.texture == next->data.draw.texture)) ? SDL_TRUE : SDL_FALSE;
+}
 
-    retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+/* Merge runs of adjacent, compatible draw commands into a single command, so
+   the backend sets up its draw state once per run instead of once per call. */
+static void
+CoalesceRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmd = renderer->render_commands;
+    unsigned int queued = 0;
+    unsigned int coalesced = 0;
+
+    while (cmd) {
+        SDL_RenderCommand *next = cmd->next;
+        queued++;
+        coalesced++;
+        while (next && CanCoalesceRenderCommands(cmd, next)) {
+            cmd->data.draw.count += next->data.draw.count;
+            cmd->data.draw.size += next->data.draw.size;
+            renderer->stats.commands_executed--;
+            cmd->next = next->next;
+            if (renderer->render_commands_tail == next) {
+                renderer->render_commands_tail = cmd;
+            }
+            next->next = renderer->render_commands_pool;
+            renderer->render_commands_pool = next;
+            next = cmd->next;
+            queued++;
+        }
+        cmd = next;
+    }
+
+    if (renderer->log_coalescing) {
+        SDL_Log("Render commands coalesced: %u -> %u (%.2f:1)", queued, coalesced,
+                coalesced ? ((double) queued / coalesced) : 0.0);
+    }
+}
+
+/* Empty the command queue without running it. */
+static void
+ResetRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_AllocVertGap *prevgap = &renderer->vertex_data_gaps;
+    SDL_AllocVertGap *gap = prevgap;
 
     while (gap) {
         prevgap = gap;
@@ -234,6 +312,36 @@ FlushRenderCommands(SDL_Renderer *renderer)
     renderer->color_queued = SDL_FALSE;
     renderer->viewport_queued = SDL_FALSE;
     renderer->cliprect_queued = SDL_FALSE;
+}
+
+static int
+FlushRenderCommands(SDL_Renderer *renderer)
+{
+    int retval;
+
+    SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
+
+    if (renderer->recording) {
+        return 0;  /* the queue belongs to the command list being recorded. */
+    }
+
+    if (renderer->render_commands == NULL) {  /* nothing to do! */
+        SDL_assert(renderer->vertex_data_used == 0);
+        return 0;
+    }
+
+    if (renderer->coalesce_commands) {
+        CoalesceRenderCommands(renderer);
+    }
+
+    DebugLogRenderCommands(renderer->render_commands);
+
+    renderer->stats.flushes++;
+    renderer->stats.vertex_bytes += renderer->vertex_data_used;
+
+    retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+
+    ResetRenderCommands(renderer);
     return retval;
 }
 
@@ -241,8 +349,9 @@ static int
 FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
 {
     SDL_Renderer *renderer = texture->renderer;
-    if (texture->last_command_generation == renderer->render_command_generation) {
+    if (texture->last_command_generation == renderer->render_command_generation && !renderer->recording) {
         /* the current command queue depends on this texture, flush the queue now before it changes */
+        renderer->stats.texture_flushes++;
         return FlushRenderCommands(renderer);
     }
     return 0;
@@ -251,7 +360,13 @@ FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
 static SDL_INLINE int
 FlushRenderCommandsIfNotBatching(SDL_Renderer *renderer)
 {
-    return renderer->batching ? 0 : FlushRenderCommands(renderer);
+    if (renderer->batching || renderer->recording) {
+        return 0;
+    }
+    if (renderer->render_commands) {
+        renderer->stats.unbatched_flushes++;
+    }
+    return FlushRenderCommands(renderer);
 }
 
 int
@@ -383,6 +498,7 @@ AllocateRenderCommand(SDL_Renderer *renderer)
     }
 
     SDL_assert((renderer->render_commands == NULL) == (renderer->render_commands_tail == NULL));
+    renderer->stats.commands_executed++;
     if (renderer->render_commands_tail != NULL) {
         renderer->render_commands_tail->next = retval;
     } else {
@@ -401,6 +517,7 @@ QueueCmdSetViewport(SDL_Renderer *renderer)
         SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
         retval = -1;
         if (cmd != NULL) {
+            renderer->stats.commands_queued++;
             cmd->command = SDL_RENDERCMD_SETVIEWPORT;
             cmd->data.viewport.first = 0;  /* render backend will fill this in. */
             SDL_memcpy(&cmd->data.viewport.rect, &renderer->viewport, sizeof (renderer->viewport));
@@ -427,6 +544,7 @@ QueueCmdSetClipRect(SDL_Renderer *renderer)
         if (cmd == NULL) {
             retval = -1;
         } else {
+            renderer->stats.commands_queued++;
             cmd->command = SDL_RENDERCMD_SETCLIPRECT;
             cmd->data.cliprect.enabled = renderer->clipping_enabled;
             SDL_memcpy(&cmd->data.cliprect.rect, &renderer->clip_rect, sizeof (cmd->data.cliprect.rect));
@@ -449,6 +567,7 @@ QueueCmdSetDrawColor(SDL_Renderer *renderer, const Uint8 r, const Uint8 g, const
         retval = -1;
 
         if (cmd != NULL) {
+            renderer->stats.commands_queued++;
             cmd->command = SDL_RENDERCMD_SETDRAWCOLOR;
             cmd->data.color.first = 0;  /* render backend will fill this in. */
             cmd->data.color.r = r;
@@ -475,6 +594,7 @@ QueueCmdClear(SDL_Renderer *renderer)
         return -1;
     }
 
+    renderer->stats.commands_queued++;
     cmd->command = SDL_RENDERCMD_CLEAR;
     cmd->data.color.first = 0;
     cmd->data.color.r = renderer->r;
@@ -508,9 +628,11 @@ PrepQueueCmdDrawSolid(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtyp
     if (PrepQueueCmdDraw(renderer, renderer->r, renderer->g, renderer->b, renderer->a) == 0) {
         cmd = AllocateRenderCommand(renderer);
         if (cmd != NULL) {
+            renderer->stats.commands_queued++;
             cmd->command = cmdtype;
             cmd->data.draw.first = 0;  /* render backend will fill this in. */
             cmd->data.draw.count = 0;  /* render backend will fill this in. */
+            cmd->data.draw.size = 0;
             cmd->data.draw.r = renderer->r;
             cmd->data.draw.g = renderer->g;
             cmd->data.draw.b = renderer->b;
@@ -522,15 +644,29 @@ PrepQueueCmdDrawSolid(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtyp
     return cmd;
 }
 
+/* Note how much vertex data the backend just queued for cmd. Only data appended
+   to the end of the vertex buffer (not placed in a gap) is known to follow the
+   previous command's, so anything else is left at zero and never coalesced. */
+static void
+UpdateCmdDrawSize(SDL_Renderer *renderer, SDL_RenderCommand *cmd, const size_t used)
+{
+    if ((cmd->data.draw.first >= used) && (renderer->vertex_data_used > cmd->data.draw.first)) {
+        cmd->data.draw.size = renderer->vertex_data_used - cmd->data.draw.first;
+    }
+}
+
 static int
 QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint * points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDrawSolid(renderer, SDL_RENDERCMD_DRAW_POINTS);
     int retval = -1;
     if (cmd != NULL) {
+        const size_t used = renderer->vertex_data_used;
         retval = renderer->QueueDrawPoints(renderer, cmd, points, count);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            UpdateCmdDrawSize(renderer, cmd, used);
         }
     }
     return retval;
@@ -556,29 +692,35 @@ QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect * rects, const int cou
     SDL_RenderCommand *cmd = PrepQueueCmdDrawSolid(renderer, SDL_RENDERCMD_FILL_RECTS);
     int retval = -1;
     if (cmd != NULL) {
+        const size_t used = renderer->vertex_data_used;
         retval = renderer->QueueFillRects(renderer, cmd, rects, count);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            UpdateCmdDrawSize(renderer, cmd, used);
         }
     }
     return retval;
 }
 
 static SDL_RenderCommand *
-PrepQueueCmdDrawTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_RenderCommandType cmdtype)
+PrepQueueCmdDrawTextureMod(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_RenderCommandType cmdtype,
+                           const Uint8 r, const Uint8 g, const Uint8 b, const Uint8 a)
 {
     /* !!! FIXME: drop this draw if viewport w or h is zero. */
     SDL_RenderCommand *cmd = NULL;
-    if (PrepQueueCmdDraw(renderer, texture->r, texture->g, texture->b, texture->a) == 0) {
+    if (PrepQueueCmdDraw(renderer, r, g, b, a) == 0) {
         cmd = AllocateRenderCommand(renderer);
         if (cmd != NULL) {
+            renderer->stats.commands_queued++;
             cmd->command = cmdtype;
             cmd->data.draw.first = 0;  /* render backend will fill this in. */
             cmd->data.draw.count = 0;  /* render backend will fill this in. */
-            cmd->data.draw.r = texture->r;
-            cmd->data.draw.g = texture->g;
-            cmd->data.draw.b = texture->b;
-            cmd->data.draw.a = texture->a;
+            cmd->data.draw.size = 0;
+            cmd->data.draw.r = r;
+            cmd->data.draw.g = g;
+            cmd->data.draw.b = b;
+            cmd->data.draw.a = a;
             cmd->data.draw.blend = texture->blendMode;
             cmd->data.draw.texture = texture;
         }
@@ -586,15 +728,24 @@ PrepQueueCmdDrawTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_
     return cmd;
 }
 
+static SDL_RenderCommand *
+PrepQueueCmdDrawTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_RenderCommandType cmdtype)
+{
+    return PrepQueueCmdDrawTextureMod(renderer, texture, cmdtype, texture->r, texture->g, texture->b, texture->a);
+}
+
 static int
 QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture * texture, const SDL_Rect * srcrect, const SDL_FRect * dstrect)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDrawTexture(renderer, texture, SDL_RENDERCMD_COPY);
     int retval = -1;
     if (cmd != NULL) {
+        const size_t used = renderer->vertex_data_used;
         retval = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            UpdateCmdDrawSize(renderer, cmd, used);
         }
     }
     return retval;
@@ -617,9 +768,100 @@ QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture * texture,
     return retval;
 }
 
+/* Queue one copy of a batch. If the backend can draw many copies from one
+   command, a copy that continues the previous one (*batch) is appended to
+   it instead of getting a command of its own. */
+static int
+QueueCmdCopyBatched(SDL_Renderer *renderer, SDL_RenderCommand **batch, SDL_Texture * texture,
+                    const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+                    const Uint8 r, const Uint8 g, const Uint8 b, const Uint8 a)
+{
+    SDL_RenderCommand *cmd = *batch;
+    const size_t used = renderer->vertex_data_used;
+    int retval;
+
+    if (cmd && cmd->data.draw.size &&
+        (cmd->data.draw.r == r) && (cmd->data.draw.g == g) &&
+        (cmd->data.draw.b == b) && (cmd->data.draw.a == a)) {
+        SDL_RenderCommand next = *cmd;
+        retval = renderer->QueueCopy(renderer, &next, texture, srcrect, dstrect);
+        if (retval < 0) {
+            return retval;
+        }
+        /* An appended copy is still a command queued by the caller */
+        renderer->stats.commands_queued++;
+        if (next.data.draw.first == (cmd->data.draw.first + cmd->data.draw.size)) {
+            cmd->data.draw.count += next.data.draw.count;
+            cmd->data.draw.size += renderer->vertex_data_used - used;
+            return 0;
+        }
+
+        /* the vertices went in a gap, so they need their own command. */
+        cmd = AllocateRenderCommand(renderer);
+        if (cmd == NULL) {
+            return -1;
+        }
+        cmd->command = SDL_RENDERCMD_COPY;
+        cmd->data = next.data;
+        cmd->data.draw.size = 0;
+        UpdateCmdDrawSize(renderer, cmd, used);
+        *batch = cmd;
+        return 0;
+    }
+
+    cmd = PrepQueueCmdDrawTextureMod(renderer, texture, SDL_RENDERCMD_COPY, r, g, b, a);
+    if (cmd == NULL) {
+        return -1;
+    }
+    retval = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
+    if (retval < 0) {
+        cmd->command = SDL_RENDERCMD_NO_OP;
+        cmd = NULL;
+    } else {
+        UpdateCmdDrawSize(renderer, cmd, used);
+    }
+    *batch = renderer->coalesce_commands ? cmd : NULL;
+    return retval;
+}
+
+static int
+QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
+                 const SDL_Vertex *vertices, const int num_vertices,
+                 const int *indices, const int num_indices)
+{
+    SDL_RenderCommand *cmd;
+    int retval = -1;
+    SDL_assert(renderer->QueueGeometry != NULL);  /* should have caught at higher level. */
+    if (texture) {
+        cmd = PrepQueueCmdDrawTexture(renderer, texture, SDL_RENDERCMD_GEOMETRY);
+    } else {
+        cmd = PrepQueueCmdDrawSolid(renderer, SDL_RENDERCMD_GEOMETRY);
+    }
+    if (cmd != NULL) {
+        retval = renderer->QueueGeometry(renderer, cmd, texture, vertices, num_vertices,
+                                         indices, num_indices, renderer->scale.x, renderer->scale.y);
+        if (retval < 0) {
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        }
+    }
+    return retval;
+}
+
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
+static void SDLCALL
+SDL_RenderLogCoalescingChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_Renderer *renderer = (SDL_Renderer *) userdata;
+
+    if (hint && (*hint == '1' || SDL_strcasecmp(hint, "true") == 0)) {
+        renderer->log_coalescing = SDL_TRUE;
+    } else {
+        renderer->log_coalescing = SDL_FALSE;
+    }
+}
+
 int
 SDL_GetNumRenderDrivers(void)
 {
@@ -913,6 +1155,7 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
 
         renderer->batching = batching;
         renderer->magic = &renderer_magic;
+        renderer->serial = (Uint32) SDL_AtomicAdd(&renderer_serial, 1) + 1;
         renderer->window = window;
         renderer->target_mutex = SDL_CreateMutex();
         renderer->scale.x = 1.0f;
@@ -945,6 +1188,9 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
 
         SDL_AddEventWatch(SDL_RendererEventWatch, renderer);
 
+        SDL_AddHintCallback(SDL_HINT_RENDER_LOG_COALESCING,
+                            SDL_RenderLogCoalescingChanged, renderer);
+
         SDL_LogInfo(SDL_LOG_CATEGORY_RENDER,
                     "Created renderer: %s", renderer->info.name);
     }
@@ -966,6 +1212,7 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
     if (renderer) {
         VerifyDrawQueueFunctions(renderer);
         renderer->magic = &renderer_magic;
+        renderer->serial = (Uint32) SDL_AtomicAdd(&renderer_serial, 1) + 1;
         renderer->target_mutex = SDL_CreateMutex();
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
@@ -974,6 +1221,9 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
         renderer->render_command_generation = 1;
 
         SDL_RenderSetViewport(renderer, NULL);
+
+        SDL_AddHintCallback(SDL_HINT_RENDER_LOG_COALESCING,
+                            SDL_RenderLogCoalescingChanged, renderer);
     }
     return renderer;
 #else
@@ -1412,6 +1662,27 @@ SDL_GetTextureBlendMode(SDL_Texture * texture, SDL_BlendMode *blendMode)
     return 0;
 }
 
+static void
+CountTextureUpload(SDL_Texture * texture, const SDL_Rect * rect)
+{
+    SDL_RenderStats *stats = &texture->renderer->stats;
+    const Uint64 pixels = (Uint64) rect->w * rect->h;
+
+    stats->texture_uploads++;
+    switch (texture->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        /* full resolution Y plane plus two half resolution chroma planes */
+        stats->texture_upload_bytes += pixels + 2 * (Uint64) ((rect->w + 1) / 2) * ((rect->h + 1) / 2);
+        break;
+    default:
+        stats->texture_upload_bytes += pixels * SDL_BYTESPERPIXEL(texture->format);
+        break;
+    }
+}
+
 static int
 SDL_UpdateTextureYUV(SDL_Texture * texture, const SDL_Rect * rect,
                      const void *pixels, int pitch)
@@ -1533,6 +1804,7 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        CountTextureUpload(texture, rect);
         return renderer->UpdateTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -1645,6 +1917,7 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
             if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
                 return -1;
             }
+            CountTextureUpload(texture, rect);
             return renderer->UpdateTextureYUV(renderer, texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -1704,6 +1977,7 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        texture->locked_rect = *rect;  /* counted as an upload on unlock. */
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -1764,6 +2038,7 @@ SDL_UnlockTexture(SDL_Texture * texture)
         SDL_UnlockTextureNative(texture);
     } else {
         SDL_Renderer *renderer = texture->renderer;
+        CountTextureUpload(texture, &texture->locked_rect);
         renderer->UnlockTexture(renderer, texture);
     }
 }
@@ -1787,6 +2062,9 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         /* Nothing to do! */
         return 0;
     }
+    if (renderer->recording) {
+        return SDL_SetError("Can't change the render target while recording a command list");
+    }
 
     FlushRenderCommands(renderer);  /* time to send everything to the GPU! */
 
@@ -1822,6 +2100,7 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         SDL_UnlockMutex(renderer->target_mutex);
         return -1;
     }
+    renderer->stats.target_switches++;
 
     if (texture) {
         renderer->viewport.x = 0;
@@ -3031,6 +3310,169 @@ SDL_RenderCopyExF(SDL_Renderer * renderer, SDL_Texture * texture,
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
 
+int
+SDL_RenderGeometry(SDL_Renderer * renderer, SDL_Texture * texture,
+                   const SDL_Vertex * vertices, int num_vertices,
+                   const int * indices, int num_indices)
+{
+    int i;
+    int retval;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (texture) {
+        CHECK_TEXTURE_MAGIC(texture, -1);
+
+        if (renderer != texture->renderer) {
+            return SDL_SetError("Texture was not created with this renderer");
+        }
+    }
+
+    if (!vertices) {
+        return SDL_InvalidParamError("vertices");
+    }
+    if (num_vertices < 0) {
+        return SDL_InvalidParamError("num_vertices");
+    }
+
+    if (indices) {
+        if (num_indices < 0 || (num_indices % 3) != 0) {
+            return SDL_SetError("SDL_RenderGeometry(): num_indices must be a multiple of 3");
+        }
+        for (i = 0; i < num_indices; ++i) {
+            if (indices[i] < 0 || indices[i] >= num_vertices) {
+                return SDL_SetError("SDL_RenderGeometry(): index %d is out of range", indices[i]);
+            }
+        }
+    } else if ((num_vertices % 3) != 0) {
+        return SDL_SetError("SDL_RenderGeometry(): num_vertices must be a multiple of 3");
+    }
+
+    if (!renderer->QueueGeometry) {
+        return SDL_SetError("Renderer does not support RenderGeometry");
+    }
+
+    if ((indices ? num_indices : num_vertices) == 0) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (texture) {
+        if (texture->native) {
+            texture = texture->native;
+        }
+        texture->last_command_generation = renderer->render_command_generation;
+    }
+
+    retval = QueueCmdGeometry(renderer, texture, vertices, num_vertices, indices, indices ? num_indices : 0);
+    return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
+}
+
+int
+SDL_RenderCopyBatch(SDL_Renderer * renderer, SDL_Texture * texture,
+                    const SDL_RenderCopyItem * items, int count)
+{
+    SDL_RenderCommand *batch = NULL;
+    SDL_FRect viewport;
+    SDL_Rect r;
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!items) {
+        return SDL_InvalidParamError("items");
+    }
+    if (count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    SDL_zero(r);
+    SDL_RenderGetViewport(renderer, &r);
+    viewport.x = 0.0f;
+    viewport.y = 0.0f;
+    viewport.w = (float) r.w;
+    viewport.h = (float) r.h;
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    texture->last_command_generation = renderer->render_command_generation;
+
+    for (i = 0; i < count; i++) {
+        const SDL_RenderCopyItem *item = &items[i];
+        const Uint8 cr = (Uint8) (((Uint32) texture->r * item->color.r) / 255);
+        const Uint8 cg = (Uint8) (((Uint32) texture->g * item->color.g) / 255);
+        const Uint8 cb = (Uint8) (((Uint32) texture->b * item->color.b) / 255);
+        const Uint8 ca = (Uint8) (((Uint32) texture->a * item->color.a) / 255);
+        SDL_Rect real_srcrect;
+        SDL_FRect real_dstrect;
+        int retval;
+
+        real_srcrect.x = 0;
+        real_srcrect.y = 0;
+        real_srcrect.w = texture->w;
+        real_srcrect.h = texture->h;
+        if (!SDL_RectEmpty(&item->srcrect)) {
+            if (!SDL_IntersectRect(&item->srcrect, &real_srcrect, &real_srcrect)) {
+                continue;
+            }
+        }
+
+        real_dstrect.x = item->dstrect.x * renderer->scale.x;
+        real_dstrect.y = item->dstrect.y * renderer->scale.y;
+        real_dstrect.w = item->dstrect.w * renderer->scale.x;
+        real_dstrect.h = item->dstrect.h * renderer->scale.y;
+
+        if (item->flip == SDL_FLIP_NONE && (int)(item->angle/360) == item->angle/360) {
+            if (!SDL_HasIntersectionF(&item->dstrect, &viewport)) {
+                continue;
+            }
+            retval = QueueCmdCopyBatched(renderer, &batch, texture, &real_srcrect, &real_dstrect, cr, cg, cb, ca);
+        } else {
+            SDL_RenderCommand *cmd;
+            SDL_FPoint real_center;
+
+            if (!renderer->QueueCopyEx) {
+                return SDL_SetError("Renderer does not support RenderCopyEx");
+            }
+
+            real_center.x = item->center.x * renderer->scale.x;
+            real_center.y = item->center.y * renderer->scale.y;
+
+            retval = -1;
+            cmd = PrepQueueCmdDrawTextureMod(renderer, texture, SDL_RENDERCMD_COPY_EX, cr, cg, cb, ca);
+            if (cmd != NULL) {
+                retval = renderer->QueueCopyEx(renderer, cmd, texture, &real_srcrect, &real_dstrect,
+                                               item->angle, &real_center, item->flip);
+                if (retval < 0) {
+                    cmd->command = SDL_RENDERCMD_NO_OP;
+                }
+            }
+            batch = NULL;
+        }
+
+        if (retval < 0) {
+            return retval;
+        }
+    }
+
+    return FlushRenderCommandsIfNotBatching(renderer);
+}
+
 int
 SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                      Uint32 format, void * pixels, int pitch)
@@ -3042,6 +3484,9 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
     if (!renderer->RenderReadPixels) {
         return SDL_Unsupported();
     }
+    if (renderer->recording) {
+        return SDL_SetError("Can't read pixels while recording a command list");
+    }
 
     FlushRenderCommands(renderer);  /* we need to render before we read the results. */
 
@@ -3077,13 +3522,254 @@ SDL_RenderPresent(SDL_Renderer * renderer)
 
     FlushRenderCommands(renderer);  /* time to send everything to the GPU! */
 
+    renderer->last_stats = renderer->stats;
+    SDL_zero(renderer->stats);
+
     /* Don't present while we're hidden */
     if (renderer->hidden) {
         return;
     }
+    if (renderer->capture) {
+        SDL_CaptureRenderFrame(renderer->capture, renderer);
+    }
     renderer->RenderPresent(renderer);
 }
 
+int
+SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats * stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    *stats = renderer->last_stats;
+    return 0;
+}
+
+int
+SDL_RenderBeginCommandList(SDL_Renderer * renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!renderer->TranslateCommand) {
+        return SDL_Unsupported();
+    }
+    if (renderer->recording) {
+        return SDL_SetError("Already recording a command list");
+    }
+
+    /* Start from an empty queue, so the list's vertex data starts at zero
+       and its first draw queues the full draw state. */
+    FlushRenderCommands(renderer);
+    renderer->color_queued = SDL_FALSE;
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+
+    renderer->recording = SDL_TRUE;
+    return 0;
+}
+
+SDL_RenderCommandList *
+SDL_RenderEndCommandList(SDL_Renderer * renderer)
+{
+    SDL_RenderCommandList *list;
+    SDL_RenderCommand *cmd;
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, NULL);
+
+    if (!renderer->recording) {
+        SDL_SetError("Not recording a command list");
+        return NULL;
+    }
+    renderer->recording = SDL_FALSE;
+
+    if (renderer->coalesce_commands && renderer->render_commands) {
+        CoalesceRenderCommands(renderer);
+    }
+
+    list = (SDL_RenderCommandList *) SDL_calloc(1, sizeof (*list));
+    if (!list) {
+        SDL_OutOfMemory();
+        ResetRenderCommands(renderer);
+        return NULL;
+    }
+    list->renderer_serial = renderer->serial;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        list->num_commands++;
+    }
+    if (list->num_commands) {
+        list->commands = (SDL_RenderCommand *) SDL_malloc(list->num_commands * sizeof (SDL_RenderCommand));
+    }
+    if (renderer->vertex_data_used) {
+        list->vertices = SDL_malloc(renderer->vertex_data_used);
+        list->vertsize = renderer->vertex_data_used;
+    }
+    if ((list->num_commands && !list->commands) || (list->vertsize && !list->vertices)) {
+        SDL_OutOfMemory();
+        SDL_DestroyRenderCommandList(list);
+        ResetRenderCommands(renderer);
+        return NULL;
+    }
+
+    for (cmd = renderer->render_commands, i = 0; cmd; cmd = cmd->next, i++) {
+        list->commands[i] = *cmd;
+        list->commands[i].next = NULL;
+    }
+    if (list->vertsize) {
+        SDL_memcpy(list->vertices, renderer->vertex_data, list->vertsize);
+    }
+
+    /* These run when the list is replayed, not now. */
+    renderer->stats.commands_executed -= list->num_commands;
+
+    ResetRenderCommands(renderer);
+    return list;
+}
+
+int
+SDL_RenderReplayCommandList(SDL_Renderer * renderer, const SDL_RenderCommandList * list, int dx, int dy)
+{
+    size_t first = 0;
+    float x, y;
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!list) {
+        return SDL_InvalidParamError("list");
+    }
+    if (list->renderer_serial != renderer->serial) {
+        return SDL_SetError("Command list was not recorded with this renderer");
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (list->vertsize) {
+        void *vertices = SDL_AllocateRenderVertices(renderer, list->vertsize, 0, &first);
+        if (!vertices) {
+            return -1;
+        }
+        SDL_memcpy(vertices, list->vertices, list->vertsize);
+    }
+
+    x = dx * renderer->scale.x;
+    y = dy * renderer->scale.y;
+
+    for (i = 0; i < list->num_commands; i++) {
+        SDL_RenderCommand *cmd = AllocateRenderCommand(renderer);
+        if (!cmd) {
+            return -1;
+        }
+
+        renderer->stats.commands_queued++;
+        cmd->command = list->commands[i].command;
+        cmd->data = list->commands[i].data;
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT:
+                cmd->data.viewport.first += first;
+                break;
+
+            case SDL_RENDERCMD_SETDRAWCOLOR:
+            case SDL_RENDERCMD_CLEAR:
+                cmd->data.color.first += first;
+                break;
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+            case SDL_RENDERCMD_FILL_RECTS:
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
+            case SDL_RENDERCMD_GEOMETRY:
+                cmd->data.draw.first += first;
+                if (x != 0.0f || y != 0.0f) {
+                    renderer->TranslateCommand(renderer, cmd, ((Uint8 *) renderer->vertex_data) + cmd->data.draw.first, x, y);
+                }
+                if (cmd->data.draw.texture) {
+                    cmd->data.draw.texture->last_command_generation = renderer->render_command_generation;
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* The list queued its own draw state, so requeue ours before the next draw. */
+    renderer->color_queued = SDL_FALSE;
+    renderer->viewport_queued = SDL_FALSE;
+    renderer->cliprect_queued = SDL_FALSE;
+
+    return FlushRenderCommandsIfNotBatching(renderer);
+}
+
+void
+SDL_DestroyRenderCommandList(SDL_RenderCommandList * list)
+{
+    if (!list) {
+        return;
+    }
+    SDL_free(list->commands);
+    SDL_free(list->vertices);
+    SDL_free(list);
+}
+
+int
+SDL_RenderStartCapture(SDL_Renderer * renderer, SDL_RWops * dst, int freedst,
+                       SDL_RenderCaptureFormat format, int num_buffers)
+{
+    SDL_DisplayMode mode;
+    int refresh_rate = 60;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (format != SDL_RENDERCAPTURE_RAW && format != SDL_RENDERCAPTURE_PPM &&
+        format != SDL_RENDERCAPTURE_Y4M) {
+        return SDL_InvalidParamError("format");
+    }
+    if (num_buffers <= 0) {
+        return SDL_InvalidParamError("num_buffers");
+    }
+    if (renderer->capture) {
+        return SDL_SetError("The renderer is already being captured");
+    }
+
+    if (renderer->window &&
+        SDL_GetWindowDisplayMode(renderer->window, &mode) == 0 && mode.refresh_rate > 0) {
+        refresh_rate = mode.refresh_rate;
+    }
+
+    renderer->capture = SDL_CreateRenderCapture(dst, freedst, format, num_buffers, refresh_rate);
+    if (!renderer->capture) {
+        return -1;
+    }
+    return 0;
+}
+
+int
+SDL_RenderStopCapture(SDL_Renderer * renderer)
+{
+    SDL_RenderCapture *capture;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    capture = renderer->capture;
+    if (!capture) {
+        return SDL_SetError("The renderer isn't being captured");
+    }
+    renderer->capture = NULL;
+    return SDL_DestroyRenderCapture(capture);
+}
+
 void
 SDL_DestroyTexture(SDL_Texture * texture)
 {
@@ -3132,6 +3818,14 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
+    SDL_DelHintCallback(SDL_HINT_RENDER_LOG_COALESCING,
+                        SDL_RenderLogCoalescingChanged, renderer);
+
+    if (renderer->capture) {
+        SDL_DestroyRenderCapture(renderer->capture);
+        renderer->capture = NULL;
+    }
+
     if (renderer->render_commands_tail != NULL) {
         renderer->render_commands_tail->next = renderer->render_commands_pool;
         cmd = renderer->render_commands;
@@ -3254,6 +3948,9 @@ SDL_GetShortBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MOD_FULL) {
         return SDL_BLENDMODE_MOD;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    }
     return blendMode;
 }
 
@@ -3272,6 +3969,9 @@ SDL_GetLongBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MOD) {
         return SDL_BLENDMODE_MOD_FULL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL;
+    }
     return blendMode;
 }
 
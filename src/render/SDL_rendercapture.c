@@ -0,0 +1,323 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Capture of presented frames to an SDL_RWops.
+
+   At present time the frame is read back into one of a small pool of
+   buffers and queued. A writer thread converts the queued frames to the
+   output format and writes them out, then hands the buffers back. The render
+   thread only waits when every buffer is still queued, so the output stays
+   complete while disk I/O is kept off the render thread.
+*/
+
+#include "SDL_sysrender.h"
+#include "SDL_thread.h"
+
+typedef struct SDL_CaptureFrame
+{
+    int w, h;
+    Uint8 *pixels;              /* ARGB8888, w * 4 bytes per row */
+    size_t size;
+    struct SDL_CaptureFrame *next;      /* in the free list or the queue */
+    struct SDL_CaptureFrame *all_next;  /* in the list of all buffers */
+} SDL_CaptureFrame;
+
+struct SDL_RenderCapture
+{
+    SDL_RWops *dst;
+    int freedst;
+    SDL_RenderCaptureFormat format;
+    int refresh_rate;
+
+    SDL_mutex *lock;
+    SDL_cond *cond;             /* signaled when a frame is queued or a buffer freed */
+    SDL_CaptureFrame *frames;   /* all the buffers, for cleanup */
+    SDL_CaptureFrame *free_frames;
+    SDL_CaptureFrame *queue_head;
+    SDL_CaptureFrame *queue_tail;
+    SDL_bool quit;
+    SDL_bool failed;
+
+    /* Only used by the render thread */
+    int stream_w, stream_h;
+
+    /* Only used by the writer thread */
+    SDL_Thread *thread;
+    Uint8 *scratch;
+    size_t scratch_size;
+    SDL_bool wrote_header;
+};
+
+static SDL_bool
+SDL_CaptureScratch(SDL_RenderCapture *capture, size_t size)
+{
+    if (size > capture->scratch_size) {
+        Uint8 *scratch = (Uint8 *) SDL_realloc(capture->scratch, size);
+        if (!scratch) {
+            return SDL_FALSE;
+        }
+        capture->scratch = scratch;
+        capture->scratch_size = size;
+    }
+    return SDL_TRUE;
+}
+
+/* Runs on the writer thread */
+static SDL_bool
+SDL_WriteCaptureFrame(SDL_RenderCapture *capture, const SDL_CaptureFrame *frame)
+{
+    SDL_RWops *dst = capture->dst;
+    const int w = frame->w;
+    const int h = frame->h;
+    char header[64];
+    size_t size;
+
+    switch (capture->format) {
+    case SDL_RENDERCAPTURE_RAW:
+        return (SDL_RWwrite(dst, frame->pixels, (size_t) w * h * 4, 1) == 1);
+
+    case SDL_RENDERCAPTURE_PPM:
+        size = (size_t) w * h * 3;
+        if (!SDL_CaptureScratch(capture, size) ||
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, frame->pixels, w * 4,
+                              SDL_PIXELFORMAT_RGB24, capture->scratch, w * 3) < 0) {
+            return SDL_FALSE;
+        }
+        SDL_snprintf(header, sizeof(header), "P6\n%d %d\n255\n", w, h);
+        return (SDL_RWwrite(dst, header, SDL_strlen(header), 1) == 1 &&
+                SDL_RWwrite(dst, capture->scratch, size, 1) == 1);
+
+    case SDL_RENDERCAPTURE_Y4M:
+        size = (size_t) w * h + 2 * (size_t) ((w + 1) / 2) * ((h + 1) / 2);
+        if (!SDL_CaptureScratch(capture, size) ||
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, frame->pixels, w * 4,
+                              SDL_PIXELFORMAT_IYUV, capture->scratch, w) < 0) {
+            return SDL_FALSE;
+        }
+        if (!capture->wrote_header) {
+            SDL_snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n",
+                         w, h, capture->refresh_rate);
+            if (SDL_RWwrite(dst, header, SDL_strlen(header), 1) != 1) {
+                return SDL_FALSE;
+            }
+            capture->wrote_header = SDL_TRUE;
+        }
+        return (SDL_RWwrite(dst, "FRAME\n", 6, 1) == 1 &&
+                SDL_RWwrite(dst, capture->scratch, size, 1) == 1);
+
+    default:
+        return SDL_FALSE;
+    }
+}
+
+static int SDLCALL
+SDL_CaptureThread(void *arg)
+{
+    SDL_RenderCapture *capture = (SDL_RenderCapture *) arg;
+
+    SDL_LockMutex(capture->lock);
+    for (;;) {
+        SDL_CaptureFrame *frame;
+        SDL_bool written;
+
+        while (!capture->queue_head && !capture->quit) {
+            SDL_CondWait(capture->cond, capture->lock);
+        }
+        frame = capture->queue_head;
+        if (!frame) {
+            break;  /* quitting, and everything has been written */
+        }
+        capture->queue_head = frame->next;
+        if (!capture->queue_head) {
+            capture->queue_tail = NULL;
+        }
+
+        written = SDL_TRUE;
+        if (!capture->failed) {
+            SDL_UnlockMutex(capture->lock);
+            written = SDL_WriteCaptureFrame(capture, frame);
+            SDL_LockMutex(capture->lock);
+        }
+        if (!written) {
+            capture->failed = SDL_TRUE;
+        }
+        frame->next = capture->free_frames;
+        capture->free_frames = frame;
+        SDL_CondBroadcast(capture->cond);
+    }
+    SDL_UnlockMutex(capture->lock);
+    return 0;
+}
+
+SDL_RenderCapture *
+SDL_CreateRenderCapture(SDL_RWops *dst, int freedst, SDL_RenderCaptureFormat format,
+                        int num_buffers, int refresh_rate)
+{
+    SDL_RenderCapture *capture;
+    int i;
+
+    capture = (SDL_RenderCapture *) SDL_calloc(1, sizeof(*capture));
+    if (!capture) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    capture->dst = dst;
+    capture->format = format;
+    capture->refresh_rate = refresh_rate;
+    capture->lock = SDL_CreateMutex();
+    capture->cond = SDL_CreateCond();
+    if (!capture->lock || !capture->cond) {
+        SDL_DestroyRenderCapture(capture);
+        return NULL;
+    }
+
+    /* The pixel buffers are allocated once the frame size is known */
+    for (i = 0; i < num_buffers; ++i) {
+        SDL_CaptureFrame *frame = (SDL_CaptureFrame *) SDL_calloc(1, sizeof(*frame));
+        if (!frame) {
+            SDL_OutOfMemory();
+            SDL_DestroyRenderCapture(capture);
+            return NULL;
+        }
+        frame->all_next = capture->frames;
+        capture->frames = frame;
+        frame->next = capture->free_frames;
+        capture->free_frames = frame;
+    }
+
+    capture->thread = SDL_CreateThread(SDL_CaptureThread, "SDLRenderCapture", capture);
+    if (!capture->thread) {
+        SDL_DestroyRenderCapture(capture);
+        return NULL;
+    }
+
+    /* Everything is set up, the capture owns the stream now */
+    capture->freedst = freedst;
+    return capture;
+}
+
+void
+SDL_CaptureRenderFrame(SDL_RenderCapture *capture, SDL_Renderer *renderer)
+{
+    SDL_CaptureFrame *frame;
+    SDL_Rect rect;
+    size_t size;
+
+    if (renderer->target || SDL_GetRendererOutputSize(renderer, &rect.w, &rect.h) < 0 ||
+        rect.w <= 0 || rect.h <= 0) {
+        return;
+    }
+    rect.x = 0;
+    rect.y = 0;
+
+    /* Headerless and Y4M streams can't change size */
+    if (capture->format != SDL_RENDERCAPTURE_PPM) {
+        if (!capture->stream_w) {
+            capture->stream_w = rect.w;
+            capture->stream_h = rect.h;
+        } else if (rect.w != capture->stream_w || rect.h != capture->stream_h) {
+            return;
+        }
+    }
+
+    SDL_LockMutex(capture->lock);
+    while (!capture->free_frames && !capture->failed) {
+        SDL_CondWait(capture->cond, capture->lock);
+    }
+    frame = capture->failed ? NULL : capture->free_frames;
+    if (frame) {
+        capture->free_frames = frame->next;
+    }
+    SDL_UnlockMutex(capture->lock);
+    if (!frame) {
+        return;
+    }
+
+    size = (size_t) rect.w * rect.h * 4;
+    if (size > frame->size) {
+        Uint8 *pixels = (Uint8 *) SDL_realloc(frame->pixels, size);
+        if (pixels) {
+            frame->pixels = pixels;
+            frame->size = size;
+        }
+    }
+    frame->w = rect.w;
+    frame->h = rect.h;
+
+    SDL_LockMutex(capture->lock);
+    if (size <= frame->size &&
+        renderer->RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888,
+                                   frame->pixels, rect.w * 4) == 0) {
+        frame->next = NULL;
+        if (capture->queue_tail) {
+            capture->queue_tail->next = frame;
+        } else {
+            capture->queue_head = frame;
+        }
+        capture->queue_tail = frame;
+    } else {
+        frame->next = capture->free_frames;
+        capture->free_frames = frame;
+    }
+    SDL_CondBroadcast(capture->cond);
+    SDL_UnlockMutex(capture->lock);
+}
+
+int
+SDL_DestroyRenderCapture(SDL_RenderCapture *capture)
+{
+    SDL_bool failed;
+
+    if (capture->thread) {
+        SDL_LockMutex(capture->lock);
+        capture->quit = SDL_TRUE;
+        SDL_CondBroadcast(capture->cond);
+        SDL_UnlockMutex(capture->lock);
+        SDL_WaitThread(capture->thread, NULL);
+    }
+    failed = capture->failed;
+
+    while (capture->frames) {
+        SDL_CaptureFrame *next = capture->frames->all_next;
+        SDL_free(capture->frames->pixels);
+        SDL_free(capture->frames);
+        capture->frames = next;
+    }
+    SDL_free(capture->scratch);
+    if (capture->cond) {
+        SDL_DestroyCond(capture->cond);
+    }
+    if (capture->lock) {
+        SDL_DestroyMutex(capture->lock);
+    }
+    if (capture->freedst && SDL_RWclose(capture->dst) < 0) {
+        failed = SDL_TRUE;
+    }
+    SDL_free(capture);
+
+    if (failed) {
+        return SDL_SetError("Couldn't write all of the captured frames");
+    }
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -31,6 +31,7 @@
 /* The SDL 2D rendering system */
 
 typedef struct SDL_RenderDriver SDL_RenderDriver;
+typedef struct SDL_RenderCapture SDL_RenderCapture;
 
 typedef enum
 {
@@ -80,7 +81,8 @@ typedef enum
     SDL_RENDERCMD_DRAW_LINES,
     SDL_RENDERCMD_FILL_RECTS,
     SDL_RENDERCMD_COPY,
-    SDL_RENDERCMD_COPY_EX
+    SDL_RENDERCMD_COPY_EX,
+    SDL_RENDERCMD_GEOMETRY
 } SDL_RenderCommandType;
 
 typedef struct SDL_RenderCommand
@@ -98,6 +100,7 @@ typedef struct SDL_RenderCommand
         struct {
             size_t first;
             size_t count;
+            size_t size;  /* bytes of vertex data from first, or 0 if not known */
             Uint8 r, g, b, a;
             SDL_BlendMode blend;
             SDL_Texture *texture;
@@ -140,7 +143,15 @@ struct SDL_Renderer
     int (*QueueCopyEx) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
                         const SDL_Rect * srcquad, const SDL_FRect * dstrect,
                         const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+    int (*QueueGeometry) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                          const SDL_Vertex * vertices, int num_vertices,
+                          const int * indices, int num_indices,
+                          float scale_x, float scale_y);
     int (*RunCommandQueue) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize);
+    /* Optional, move the vertex data queued for a draw command by (x, y) pixels.
+       Backends that set this can record command lists, so they must not keep
+       vertex data offsets anywhere but the command's "first" field. */
+    void (*TranslateCommand) (SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, float x, float y);
     int (*UpdateTexture) (SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * rect, const void *pixels,
                           int pitch);
@@ -211,6 +222,8 @@ struct SDL_Renderer
 
     SDL_bool always_batch;
     SDL_bool batching;
+    SDL_bool coalesce_commands; /**< RunCommandQueue handles any count for points, rects and copies */
+    SDL_bool log_coalescing;
     SDL_RenderCommand *render_commands;
     SDL_RenderCommand *render_commands_tail;
     SDL_RenderCommand *render_commands_pool;
@@ -222,6 +235,8 @@ struct SDL_Renderer
     SDL_bool color_queued;
     SDL_bool viewport_queued;
     SDL_bool cliprect_queued;
+    SDL_bool recording;                 /**< Commands are being queued for a command list */
+    Uint32 serial;                      /**< Unique to this renderer, so command lists can tell renderers at the same address apart */
 
     void *vertex_data;
     size_t vertex_data_used;
@@ -229,6 +244,11 @@ struct SDL_Renderer
     SDL_AllocVertGap vertex_data_gaps;
     SDL_AllocVertGap *vertex_data_gaps_pool;
 
+    SDL_RenderStats stats;          /**< Counters for the frame being drawn */
+    SDL_RenderStats last_stats;     /**< Counters for the last presented frame */
+
+    SDL_RenderCapture *capture;     /**< Frame capture started by SDL_RenderStartCapture() */
+
     void *driverdata;
 };
 
@@ -265,6 +285,11 @@ extern SDL_BlendOperation SDL_GetBlendModeAlphaOperation(SDL_BlendMode blendMode
    the next call, because it might be in an array that gets realloc()'d. */
 extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes, const size_t alignment, size_t *offset);
 
+/* Frame capture functions, in SDL_rendercapture.c */
+extern SDL_RenderCapture *SDL_CreateRenderCapture(SDL_RWops *dst, int freedst, SDL_RenderCaptureFormat format, int num_buffers, int refresh_rate);
+extern void SDL_CaptureRenderFrame(SDL_RenderCapture *capture, SDL_Renderer *renderer);
+extern int SDL_DestroyRenderCapture(SDL_RenderCapture *capture);
+
 #endif /* SDL_sysrender_h_ */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -1402,6 +1402,10 @@ D3D_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *verti
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY:
+                /* Not queued by this backend, it has no QueueGeometry. */
+                break;
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -2281,6 +2281,10 @@ D3D11_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY:
+                /* Not queued by this backend, it has no QueueGeometry. */
+                break;
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1383,6 +1383,10 @@ METAL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY:
+                /* Not queued by this backend, it has no QueueGeometry. */
+                break;
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
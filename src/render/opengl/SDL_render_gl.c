@@ -943,6 +943,43 @@ GL_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
     return 0;
 }
 
+static void
+GL_TranslateCommand(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, float x, float y)
+{
+    GLfloat *verts = (GLfloat *) vertices;
+    size_t numpoints = 0;  /* x, y pairs at the start of the vertex data */
+    size_t i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+            numpoints = cmd->data.draw.count;
+            break;
+
+        case SDL_RENDERCMD_FILL_RECTS:
+            numpoints = cmd->data.draw.count * 2;
+            break;
+
+        case SDL_RENDERCMD_COPY:
+            numpoints = 2;
+            break;
+
+        case SDL_RENDERCMD_COPY_EX:
+            /* the corners are relative to the rotation center, which follows the texture coordinates. */
+            verts[8] += x;
+            verts[9] += y;
+            break;
+
+        default:
+            break;
+    }
+
+    for (i = 0; i < numpoints; i++, verts += 2) {
+        verts[0] += x;
+        verts[1] += y;
+    }
+}
+
 static void
 SetDrawState(GL_RenderData *data, const SDL_RenderCommand *cmd, const GL_Shader shader)
 {
@@ -1299,6 +1336,10 @@ GL_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY:
+                /* Not queued by this backend, it has no QueueGeometry. */
+                break;
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1571,6 +1612,7 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueCopy = GL_QueueCopy;
     renderer->QueueCopyEx = GL_QueueCopyEx;
     renderer->RunCommandQueue = GL_RunCommandQueue;
+    renderer->TranslateCommand = GL_TranslateCommand;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
     renderer->DestroyTexture = GL_DestroyTexture;
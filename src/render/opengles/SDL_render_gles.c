@@ -701,6 +701,43 @@ GLES_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     return 0;
 }
 
+static void
+GLES_TranslateCommand(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, float x, float y)
+{
+    GLfloat *verts = (GLfloat *) vertices;
+    size_t numpoints = 0;  /* x, y pairs at the start of the vertex data */
+    size_t i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+            numpoints = cmd->data.draw.count;
+            break;
+
+        case SDL_RENDERCMD_FILL_RECTS:
+            numpoints = cmd->data.draw.count * 4;
+            break;
+
+        case SDL_RENDERCMD_COPY:
+            numpoints = 4;
+            break;
+
+        case SDL_RENDERCMD_COPY_EX:
+            /* the corners are relative to the rotation center, which follows the texture coordinates. */
+            verts[16] += x;
+            verts[17] += y;
+            break;
+
+        default:
+            break;
+    }
+
+    for (i = 0; i < numpoints; i++, verts += 2) {
+        verts[0] += x;
+        verts[1] += y;
+    }
+}
+
 static void
 SetDrawState(GLES_RenderData *data, const SDL_RenderCommand *cmd)
 {
@@ -940,6 +977,10 @@ GLES_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vert
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY:
+                /* Not queued by this backend, it has no QueueGeometry. */
+                break;
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -1150,6 +1191,7 @@ GLES_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->QueueCopy = GLES_QueueCopy;
     renderer->QueueCopyEx = GLES_QueueCopyEx;
     renderer->RunCommandQueue = GLES_RunCommandQueue;
+    renderer->TranslateCommand = GLES_TranslateCommand;
     renderer->RenderReadPixels = GLES_RenderReadPixels;
     renderer->RenderPresent = GLES_RenderPresent;
     renderer->DestroyTexture = GLES_DestroyTexture;
@@ -939,6 +939,46 @@ GLES2_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture *
     return 0;
 }
 
+static void
+GLES2_TranslateCommand(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, float x, float y)
+{
+    GLfloat *verts = (GLfloat *) vertices;
+    size_t numpoints = 0;  /* x, y pairs at the start of the vertex data */
+    size_t i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES:
+            numpoints = cmd->data.draw.count;
+            break;
+
+        case SDL_RENDERCMD_FILL_RECTS:
+            numpoints = cmd->data.draw.count * 4;
+            break;
+
+        case SDL_RENDERCMD_COPY:
+            numpoints = 4;
+            break;
+
+        case SDL_RENDERCMD_COPY_EX:
+            /* the corners, then texture coordinates and angles, then the rotation center per corner. */
+            numpoints = 4;
+            for (i = 24; i < 32; i += 2) {
+                verts[i] += x;
+                verts[i + 1] += y;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    for (i = 0; i < numpoints; i++, verts += 2) {
+        verts[0] += x;
+        verts[1] += y;
+    }
+}
+
 static int
 SetDrawState(GLES2_RenderData *data, const SDL_RenderCommand *cmd, const GLES2_ImageSource imgsrc)
 {
@@ -1326,6 +1366,10 @@ GLES2_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *ver
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY:
+                /* Not queued by this backend, it has no QueueGeometry. */
+                break;
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -2071,6 +2115,7 @@ GLES2_CreateRenderer(SDL_Window *window, Uint32 flags)
     renderer->QueueCopy           = GLES2_QueueCopy;
     renderer->QueueCopyEx         = GLES2_QueueCopyEx;
     renderer->RunCommandQueue     = GLES2_RunCommandQueue;
+    renderer->TranslateCommand    = GLES2_TranslateCommand;
     renderer->RenderReadPixels    = GLES2_RenderReadPixels;
     renderer->RenderPresent       = GLES2_RenderPresent;
     renderer->DestroyTexture      = GLES2_DestroyTexture;
@@ -26,6 +26,10 @@
 #include "SDL_render_sw_c.h"
 #include "SDL_hints.h"
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_thread.h"
+#include "../../video/SDL_blit.h"
+#include "../../video/SDL_pixels_c.h"
 
 #include "SDL_draw.h"
 #include "SDL_blendfillrect.h"
@@ -34,13 +38,57 @@
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
+#include "SDL_triangle.h"
 
 /* SDL surface based renderer implementation */
 
+/* Size of the screen tiles used when drawing on several threads */
+#define SW_TILE_SIZE    64
+
+typedef struct
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect clip;          /* surface clip rect at the time the command was binned */
+} SW_TileJob;
+
+typedef struct
+{
+    int *jobs;              /* indices into SW_TilePool::jobs, in draw order */
+    int count;
+    int allocated;
+} SW_TileBin;
+
+typedef struct
+{
+    SDL_Thread **threads;
+    int num_threads;
+    SDL_sem *start;
+    SDL_sem *done;
+    SDL_atomic_t quit;
+    SDL_atomic_t next_tile;
+
+    SDL_Surface *surface;
+    void *vertices;
+    int tiles_x;
+    int tiles_y;
+    SW_TileBin *bins;
+    int num_bins;
+    SW_TileJob *jobs;
+    int num_jobs;
+    int max_jobs;
+} SW_TilePool;
+
+/* More separate damage rects than this get collapsed into one */
+#define SW_MAX_DAMAGE_RECTS 16
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+    SW_TilePool *tiles;     /* NULL unless SDL_HINT_RENDER_SW_THREADS asked for threads */
+    SDL_Rect damage[SW_MAX_DAMAGE_RECTS];  /* window areas drawn since the last present */
+    int num_damage;
+    SDL_bool damage_all;
 } SW_RenderData;
 
 
@@ -56,6 +104,7 @@ SW_ActivateRenderer(SDL_Renderer * renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            data->damage_all = SDL_TRUE;
         }
     }
     return data->surface;
@@ -69,6 +118,9 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
         data->surface = NULL;
         data->window = NULL;
+        data->damage_all = SDL_TRUE;
+    } else if (event->event == SDL_WINDOWEVENT_EXPOSED) {
+        data->damage_all = SDL_TRUE;
     }
 }
 
@@ -91,6 +143,14 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
     }
 }
 
+static SDL_bool
+SW_SupportsBlendMode(SDL_Renderer * renderer, SDL_BlendMode blendMode)
+{
+    /* The surface blitters and the primitive blenders handle premultiplied
+       alpha directly, other custom blend modes aren't supported. */
+    return (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+}
+
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
@@ -317,6 +377,100 @@ SW_QueueCopyEx(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * te
     return 0;
 }
 
+static int
+SW_QueueGeometry(SDL_Renderer * renderer, SDL_RenderCommand *cmd, SDL_Texture * texture,
+                 const SDL_Vertex * vertices, int num_vertices, const int * indices, int num_indices,
+                 float scale_x, float scale_y)
+{
+    const int count = indices ? num_indices : num_vertices;
+    SDL_TriangleVertex *verts = (SDL_TriangleVertex *) SDL_AllocateRenderVertices(renderer, count * sizeof (SDL_TriangleVertex), 0, &cmd->data.draw.first);
+    const float subpixel = (float) (1 << SDL_TRIANGLE_SUBPIXEL_BITS);
+    const float limit = (float) (1 << 24);
+    const float x = (float) renderer->viewport.x;
+    const float y = (float) renderer->viewport.y;
+    const float texw = texture ? (float) texture->w : 0.0f;
+    const float texh = texture ? (float) texture->h : 0.0f;
+    int i;
+
+    if (!verts) {
+        return -1;
+    }
+
+    cmd->data.draw.count = count;
+
+    for (i = 0; i < count; i++, verts++) {
+        const SDL_Vertex *vertex = &vertices[indices ? indices[i] : i];
+        /* Clamp to keep the fixed point edge functions from overflowing */
+        const float px = SDL_max(-limit, SDL_min((x + vertex->position.x * scale_x) * subpixel, limit));
+        const float py = SDL_max(-limit, SDL_min((y + vertex->position.y * scale_y) * subpixel, limit));
+        verts->x = (int) SDL_floor(px + 0.5f);
+        verts->y = (int) SDL_floor(py + 0.5f);
+        verts->color = vertex->color;
+        verts->u = vertex->tex_coord.x * texw;
+        verts->v = vertex->tex_coord.y * texh;
+    }
+
+    return 0;
+}
+
+static void
+SW_TranslateCommand(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, float x, float y)
+{
+    const int dx = (int) SDL_floor(x + 0.5f);
+    const int dy = (int) SDL_floor(y + 0.5f);
+    const size_t count = cmd->data.draw.count;
+    size_t i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            SDL_Point *verts = (SDL_Point *) vertices;
+            for (i = 0; i < count; i++, verts++) {
+                verts->x += dx;
+                verts->y += dy;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            SDL_Rect *verts = (SDL_Rect *) vertices;
+            for (i = 0; i < count; i++, verts++) {
+                verts->x += dx;
+                verts->y += dy;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            SDL_Rect *verts = (SDL_Rect *) vertices;
+            for (i = 0; i < count; i++, verts += 2) {
+                verts[1].x += dx;  /* srcrect, dstrect pairs. */
+                verts[1].y += dy;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY_EX: {
+            CopyExData *copydata = (CopyExData *) vertices;
+            copydata->dstrect.x += dx;
+            copydata->dstrect.y += dy;
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            SDL_TriangleVertex *verts = (SDL_TriangleVertex *) vertices;
+            for (i = 0; i < count; i++, verts++) {
+                verts->x += dx * (1 << SDL_TRIANGLE_SUBPIXEL_BITS);
+                verts->y += dy * (1 << SDL_TRIANGLE_SUBPIXEL_BITS);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
 static int
 SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * texture,
                 const SDL_Rect * srcrect, const SDL_Rect * final_rect,
@@ -363,6 +517,11 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
         return -1;
     }
 
+    /* Scale with the same filtering as unrotated copies */
+    if (texture->scaleMode != SDL_ScaleModeNearest) {
+        src_clone->map->info.flags |= SDL_COPY_LINEAR;
+    }
+
     SDL_GetSurfaceBlendMode(src, &blendmode);
     SDL_GetSurfaceAlphaMod(src, &alphaMod);
     SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
@@ -398,7 +557,7 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
      * to clear the pixels in the destination surface. The other steps are explained below.
      */
     if (blendmode == SDL_BLENDMODE_NONE && !isOpaque) {
-        mask = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
+        mask = SDL_CreateRGBSurface(SDL_POOLED, final_rect->w, final_rect->h, 32,
                                     0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
         if (mask == NULL) {
             retval = -1;
@@ -412,7 +571,7 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Surface *surface, SDL_Texture * tex
      */
     if (!retval && (blitRequired || applyModulation)) {
         SDL_Rect scale_rect = tmp_rect;
-        src_scaled = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
+        src_scaled = SDL_CreateRGBSurface(SDL_POOLED, final_rect->w, final_rect->h, 32,
                                           0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
         if (src_scaled == NULL) {
             retval = -1;
@@ -562,17 +721,712 @@ PrepTextureForCopy(const SDL_RenderCommand *cmd)
         SDL_SetSurfaceRLE(surface, 0);
     }
 
+    /* Scaled copies are filtered according to the texture's scale mode */
+    if ((texture->scaleMode != SDL_ScaleModeNearest) != !!(surface->map->info.flags & SDL_COPY_LINEAR)) {
+        surface->map->info.flags ^= SDL_COPY_LINEAR;
+        SDL_InvalidateMap(surface->map);
+    }
+
     /* !!! FIXME: we can probably avoid some of these calls. */
     SDL_SetSurfaceColorMod(surface, r, g, b);
     SDL_SetSurfaceAlphaMod(surface, a);
     SDL_SetSurfaceBlendMode(surface, blend);
 }
 
+/* Tile-binned command execution.
+ *
+ * When enabled, draw commands that only touch the pixels inside their clipped
+ * bounds are binned into screen tiles instead of being drawn right away. The
+ * bins are drawn by a pool of threads, each tile replaying its commands in
+ * queue order clipped to the tile, so the result matches drawing the whole
+ * queue on one thread. Any other command (lines, scaled and rotated copies,
+ * RLE encoded textures, ...) waits for the binned commands to finish and is
+ * then drawn on the calling thread as usual.
+ */
+
+static SDL_bool
+TextureIsPreppedForCopy(const SDL_RenderCommand *cmd)
+{
+    const SDL_BlendMode blend = cmd->data.draw.blend;
+    SDL_Surface *surface = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+    const SDL_BlitInfo *info = &surface->map->info;
+    const Uint32 blendflags = info->flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD);
+    Uint32 wanted = 0;
+
+    if (info->r != cmd->data.draw.r || info->g != cmd->data.draw.g ||
+        info->b != cmd->data.draw.b || info->a != cmd->data.draw.a) {
+        return SDL_FALSE;
+    }
+
+    switch (blend) {
+        case SDL_BLENDMODE_BLEND: wanted = SDL_COPY_BLEND; break;
+        case SDL_BLENDMODE_BLEND_PREMULTIPLIED: wanted = SDL_COPY_BLEND_PREMULTIPLIED; break;
+        case SDL_BLENDMODE_ADD: wanted = SDL_COPY_ADD; break;
+        case SDL_BLENDMODE_MOD: wanted = SDL_COPY_MOD; break;
+        default: break;
+    }
+    if (blendflags != wanted) {
+        return SDL_FALSE;
+    }
+
+    /* PrepTextureForCopy() would turn off RLE */
+    if ((info->flags & SDL_COPY_RLE_DESIRED) &&
+        (((cmd->data.draw.r & cmd->data.draw.g & cmd->data.draw.b) != 0xFF) || cmd->data.draw.a != 0xFF ||
+         blend == SDL_BLENDMODE_ADD || blend == SDL_BLENDMODE_MOD)) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* This is SDL_UpperBlit() for an unscaled copy, clipping to clip instead of
+   the surface clip rect and running the blitter on a private copy of the blit
+   info, since SDL_SoftBlit() keeps its per-call state in the source map. */
+static void
+SW_TileBlit(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, const SDL_Rect *clip)
+{
+    SDL_BlitInfo info;
+    int srcx = srcrect->x;
+    int srcy = srcrect->y;
+    int w = srcrect->w;
+    int h = srcrect->h;
+    int dstx = dstrect->x;
+    int dsty = dstrect->y;
+    int dx, dy;
+
+    /* clip the source rectangle to the source surface */
+    if (srcx < 0) {
+        w += srcx;
+        dstx -= srcx;
+        srcx = 0;
+    }
+    if (w > src->w - srcx) {
+        w = src->w - srcx;
+    }
+    if (srcy < 0) {
+        h += srcy;
+        dsty -= srcy;
+        srcy = 0;
+    }
+    if (h > src->h - srcy) {
+        h = src->h - srcy;
+    }
+
+    /* clip the destination rectangle against the clip rectangle */
+    dx = clip->x - dstx;
+    if (dx > 0) {
+        w -= dx;
+        dstx += dx;
+        srcx += dx;
+    }
+    dx = dstx + w - clip->x - clip->w;
+    if (dx > 0) {
+        w -= dx;
+    }
+    dy = clip->y - dsty;
+    if (dy > 0) {
+        h -= dy;
+        dsty += dy;
+        srcy += dy;
+    }
+    dy = dsty + h - clip->y - clip->h;
+    if (dy > 0) {
+        h -= dy;
+    }
+    if (w <= 0 || h <= 0) {
+        return;
+    }
+
+    info = src->map->info;
+    info.src = (Uint8 *) src->pixels + srcy * src->pitch + srcx * info.src_fmt->BytesPerPixel;
+    info.src_w = w;
+    info.src_h = h;
+    info.src_pitch = src->pitch;
+    info.src_skip = info.src_pitch - info.src_w * info.src_fmt->BytesPerPixel;
+    info.dst = (Uint8 *) dst->pixels + dsty * dst->pitch + dstx * info.dst_fmt->BytesPerPixel;
+    info.dst_w = w;
+    info.dst_h = h;
+    info.dst_pitch = dst->pitch;
+    info.dst_skip = info.dst_pitch - info.dst_w * info.dst_fmt->BytesPerPixel;
+    ((SDL_BlitFunc) src->map->data)(&info);
+}
+
+static void
+SW_RunTileJob(SDL_Surface *surface, const SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *clip)
+{
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            const Uint8 r = cmd->data.color.r;
+            const Uint8 g = cmd->data.color.g;
+            const Uint8 b = cmd->data.color.b;
+            const Uint8 a = cmd->data.color.a;
+            SDL_FillRect(surface, clip, SDL_MapRGBA(surface->format, r, g, b, a));
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            const Uint32 color = SDL_MapRGBA(surface->format, r, g, b, a);
+            int i;
+            for (i = 0; i < count; i++) {
+                const int x = verts[i].x;
+                const int y = verts[i].y;
+                if (x < clip->x || y < clip->y || x >= (clip->x + clip->w) || y >= (clip->y + clip->h)) {
+                    continue;
+                }
+                if (blend == SDL_BLENDMODE_NONE) {
+                    SDL_DrawPoint(surface, x, y, color);
+                } else {
+                    SDL_BlendPoint(surface, x, y, blend, r, g, b, a);
+                }
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const Uint8 r = cmd->data.draw.r;
+            const Uint8 g = cmd->data.draw.g;
+            const Uint8 b = cmd->data.draw.b;
+            const Uint8 a = cmd->data.draw.a;
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const SDL_BlendMode blend = cmd->data.draw.blend;
+            const Uint32 color = SDL_MapRGBA(surface->format, r, g, b, a);
+            SDL_Rect rect;
+            int i;
+            for (i = 0; i < count; i++) {
+                if (!SDL_IntersectRect(&verts[i], clip, &rect)) {
+                    continue;
+                }
+                if (blend == SDL_BLENDMODE_NONE) {
+                    SDL_FillRect(surface, &rect, color);
+                } else {
+                    SDL_BlendFillRect(surface, &rect, blend, r, g, b, a);
+                }
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const size_t count = cmd->data.draw.count;
+            SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+            size_t i;
+            for (i = 0; i < count; i++, verts += 2) {
+                SW_TileBlit(src, &verts[0], surface, &verts[1], clip);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            const SDL_TriangleVertex *verts = (SDL_TriangleVertex *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const int count = (int) cmd->data.draw.count;
+            SDL_Texture *texture = cmd->data.draw.texture;
+            if (texture) {
+                SDL_BlitTriangles((SDL_Surface *) texture->driverdata, surface, clip, verts, count, cmd->data.draw.blend,
+                                  cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+            } else {
+                SDL_FillTriangles(surface, clip, verts, count, cmd->data.draw.blend);
+            }
+            break;
+        }
+
+        default:
+            SDL_assert(!"Unexpected command in a tile bin");
+            break;
+    }
+}
+
+static void
+SW_RunTiles(SW_TilePool *pool)
+{
+    const int num_tiles = pool->tiles_x * pool->tiles_y;
+    SDL_Surface *surface = pool->surface;
+    int tile;
+
+    while ((tile = SDL_AtomicAdd(&pool->next_tile, 1)) < num_tiles) {
+        const SW_TileBin *bin = &pool->bins[tile];
+        SDL_Rect rect, clip;
+        int i;
+
+        rect.x = (tile % pool->tiles_x) * SW_TILE_SIZE;
+        rect.y = (tile / pool->tiles_x) * SW_TILE_SIZE;
+        rect.w = SDL_min(SW_TILE_SIZE, surface->w - rect.x);
+        rect.h = SDL_min(SW_TILE_SIZE, surface->h - rect.y);
+
+        for (i = 0; i < bin->count; i++) {
+            const SW_TileJob *job = &pool->jobs[bin->jobs[i]];
+            if (SDL_IntersectRect(&job->clip, &rect, &clip)) {
+                SW_RunTileJob(surface, job->cmd, pool->vertices, &clip);
+            }
+        }
+    }
+}
+
+static int SDLCALL
+SW_TileThread(void *arg)
+{
+    SW_TilePool *pool = (SW_TilePool *) arg;
+
+    for (;;) {
+        SDL_SemWait(pool->start);
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+        SW_RunTiles(pool);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+/* Draw everything binned so far and empty the bins */
+static void
+SW_FlushTiles(SW_TilePool *pool)
+{
+    SDL_Surface *surface = pool->surface;
+    SDL_Rect clip_rect;
+    int i;
+
+    if (pool->num_jobs == 0) {
+        return;
+    }
+
+    /* Jobs are already clipped, and the clip rect may have moved on since they were binned */
+    clip_rect = surface->clip_rect;
+    SDL_SetClipRect(surface, NULL);
+
+    SDL_AtomicSet(&pool->next_tile, 0);
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_SemPost(pool->start);
+    }
+    SW_RunTiles(pool);
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_SemWait(pool->done);
+    }
+
+    SDL_SetClipRect(surface, &clip_rect);
+
+    for (i = 0; i < pool->tiles_x * pool->tiles_y; i++) {
+        pool->bins[i].count = 0;
+    }
+    pool->num_jobs = 0;
+}
+
+/* Get the pool ready to bin commands drawn to surface.
+   Returns SDL_FALSE if the queue has to be drawn on this thread. */
+static SDL_bool
+SW_SetupTiles(SW_TilePool *pool, SDL_Surface *surface, void *vertices)
+{
+    const int tiles_x = (surface->w + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+    const int tiles_y = (surface->h + SW_TILE_SIZE - 1) / SW_TILE_SIZE;
+
+    SDL_assert(pool->num_jobs == 0);
+
+    /* The worker threads write straight to the pixels */
+    if (SDL_MUSTLOCK(surface) || surface->format->BitsPerPixel < 8) {
+        return SDL_FALSE;
+    }
+
+    if (tiles_x * tiles_y > pool->num_bins) {
+        SW_TileBin *bins = (SW_TileBin *) SDL_realloc(pool->bins, tiles_x * tiles_y * sizeof (*bins));
+        if (!bins) {
+            return SDL_FALSE;
+        }
+        SDL_memset(&bins[pool->num_bins], 0, (tiles_x * tiles_y - pool->num_bins) * sizeof (*bins));
+        pool->bins = bins;
+        pool->num_bins = tiles_x * tiles_y;
+    }
+
+    pool->surface = surface;
+    pool->vertices = vertices;
+    pool->tiles_x = tiles_x;
+    pool->tiles_y = tiles_y;
+    return SDL_TRUE;
+}
+
+static SDL_bool
+SW_BinJob(SW_TilePool *pool, const SDL_RenderCommand *cmd, const SDL_Rect *clip, const SDL_Rect *bounds)
+{
+    SDL_Rect rect;
+    int tx0, ty0, tx1, ty1, tx, ty;
+
+    if (!SDL_IntersectRect(bounds, clip, &rect)) {
+        return SDL_TRUE;  /* nothing to draw. */
+    }
+
+    tx0 = rect.x / SW_TILE_SIZE;
+    ty0 = rect.y / SW_TILE_SIZE;
+    tx1 = (rect.x + rect.w - 1) / SW_TILE_SIZE;
+    ty1 = (rect.y + rect.h - 1) / SW_TILE_SIZE;
+
+    /* Make room first, so running out of memory leaves the bins untouched */
+    if (pool->num_jobs == pool->max_jobs) {
+        const int max_jobs = pool->max_jobs ? (pool->max_jobs * 2) : 64;
+        SW_TileJob *jobs = (SW_TileJob *) SDL_realloc(pool->jobs, max_jobs * sizeof (*jobs));
+        if (!jobs) {
+            return SDL_FALSE;
+        }
+        pool->jobs = jobs;
+        pool->max_jobs = max_jobs;
+    }
+    for (ty = ty0; ty <= ty1; ty++) {
+        for (tx = tx0; tx <= tx1; tx++) {
+            SW_TileBin *bin = &pool->bins[ty * pool->tiles_x + tx];
+            if (bin->count == bin->allocated) {
+                const int allocated = bin->allocated ? (bin->allocated * 2) : 16;
+                int *jobs = (int *) SDL_realloc(bin->jobs, allocated * sizeof (*jobs));
+                if (!jobs) {
+                    return SDL_FALSE;
+                }
+                bin->jobs = jobs;
+                bin->allocated = allocated;
+            }
+        }
+    }
+
+    for (ty = ty0; ty <= ty1; ty++) {
+        for (tx = tx0; tx <= tx1; tx++) {
+            SW_TileBin *bin = &pool->bins[ty * pool->tiles_x + tx];
+            bin->jobs[bin->count++] = pool->num_jobs;
+        }
+    }
+    pool->jobs[pool->num_jobs].cmd = cmd;
+    pool->jobs[pool->num_jobs].clip = *clip;
+    pool->num_jobs++;
+    return SDL_TRUE;
+}
+
+/* Bin a draw command for the worker threads if it can be split into tiles.
+   Returns SDL_FALSE if the caller has to draw it, after any binned commands
+   have been drawn. */
+static SDL_bool
+SW_TileCommand(SW_TilePool *pool, const SDL_RenderCommand *cmd, void *vertices)
+{
+    SDL_Surface *surface = pool->surface;
+    SDL_Rect bounds;
+    SDL_bool binned = SDL_FALSE;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+        case SDL_RENDERCMD_SETVIEWPORT:
+        case SDL_RENDERCMD_SETCLIPRECT:
+            return SDL_FALSE;  /* state changes only affect later commands, no need to wait. */
+
+        case SDL_RENDERCMD_CLEAR: {
+            /* By definition the clear ignores the clip rect */
+            bounds.x = bounds.y = 0;
+            bounds.w = surface->w;
+            bounds.h = surface->h;
+            binned = SW_BinJob(pool, cmd, &bounds, &bounds);
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            if (count > 0) {
+                SDL_EnclosePoints(verts, count, NULL, &bounds);
+                binned = SW_BinJob(pool, cmd, &surface->clip_rect, &bounds);
+            } else {
+                binned = SDL_TRUE;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const int count = (int) cmd->data.draw.count;
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            int i;
+            SDL_zero(bounds);
+            for (i = 0; i < count; i++) {
+                SDL_UnionRect(&bounds, &verts[i], &bounds);
+            }
+            binned = SW_BinJob(pool, cmd, &surface->clip_rect, &bounds);
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const size_t count = cmd->data.draw.count;
+            SDL_Surface *src = (SDL_Surface *) cmd->data.draw.texture->driverdata;
+            size_t i;
+
+            SDL_zero(bounds);
+            for (i = 0; i < count; i++, verts += 2) {
+                if (verts[0].w != verts[1].w || verts[0].h != verts[1].h) {
+                    break;  /* scaled copies are clipped with rounding, so they can't be split. */
+                }
+                SDL_UnionRect(&bounds, &verts[1], &bounds);
+            }
+            if (i < count) {
+                break;
+            }
+
+            /* Binned copies share the texture's blit map, so it can't change under them */
+            if (!TextureIsPreppedForCopy(cmd)) {
+                SW_FlushTiles(pool);
+                PrepTextureForCopy(cmd);
+            }
+            if ((src->map->dst != surface) ||
+                (surface->format->palette &&
+                 src->map->dst_palette_version != surface->format->palette->version) ||
+                (src->format->palette &&
+                 src->map->src_palette_version != src->format->palette->version)) {
+                if (SDL_MapSurface(src, surface) < 0) {
+                    break;
+                }
+            }
+            if (src->flags & SDL_RLEACCEL) {
+                break;  /* RLE blits keep their state in the surface. */
+            }
+            binned = SW_BinJob(pool, cmd, &surface->clip_rect, &bounds);
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            const SDL_TriangleVertex *verts = (SDL_TriangleVertex *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const int count = (int) cmd->data.draw.count;
+            SDL_Texture *texture = cmd->data.draw.texture;
+            int minx, miny, maxx, maxy;
+            int i;
+
+            if (texture && SDL_MUSTLOCK((SDL_Surface *) texture->driverdata)) {
+                break;  /* locking decodes RLE in place. */
+            }
+            if (count < 3) {
+                binned = SDL_TRUE;
+                break;
+            }
+            minx = maxx = verts[0].x;
+            miny = maxy = verts[0].y;
+            for (i = 1; i < count; i++) {
+                minx = SDL_min(minx, verts[i].x);
+                maxx = SDL_max(maxx, verts[i].x);
+                miny = SDL_min(miny, verts[i].y);
+                maxy = SDL_max(maxy, verts[i].y);
+            }
+            bounds.x = minx >> SDL_TRIANGLE_SUBPIXEL_BITS;
+            bounds.y = miny >> SDL_TRIANGLE_SUBPIXEL_BITS;
+            bounds.w = (maxx >> SDL_TRIANGLE_SUBPIXEL_BITS) - bounds.x + 1;
+            bounds.h = (maxy >> SDL_TRIANGLE_SUBPIXEL_BITS) - bounds.y + 1;
+            binned = SW_BinJob(pool, cmd, &surface->clip_rect, &bounds);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    if (!binned) {
+        SW_FlushTiles(pool);
+    }
+    return binned;
+}
+
+static void
+SW_DestroyTilePool(SW_TilePool *pool)
+{
+    int i;
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_SemPost(pool->start);
+    }
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    if (pool->start) {
+        SDL_DestroySemaphore(pool->start);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    for (i = 0; i < pool->num_bins; i++) {
+        SDL_free(pool->bins[i].jobs);
+    }
+    SDL_free(pool->bins);
+    SDL_free(pool->jobs);
+    SDL_free(pool->threads);
+    SDL_free(pool);
+}
+
+/* Returns NULL if threaded drawing isn't wanted or isn't available */
+static SW_TilePool *
+SW_CreateTilePool(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SW_THREADS);
+    const int num_threads = hint ? SDL_atoi(hint) : 0;
+    SW_TilePool *pool;
+
+    if (num_threads <= 1) {
+        return NULL;
+    }
+
+    pool = (SW_TilePool *) SDL_calloc(1, sizeof (*pool));
+    if (!pool) {
+        return NULL;
+    }
+    /* The calling thread draws tiles too */
+    pool->threads = (SDL_Thread **) SDL_calloc(num_threads - 1, sizeof (SDL_Thread *));
+    pool->start = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->threads || !pool->start || !pool->done) {
+        SW_DestroyTilePool(pool);
+        return NULL;
+    }
+    while (pool->num_threads < num_threads - 1) {
+        SDL_Thread *thread = SDL_CreateThread(SW_TileThread, "SDLSWRender", pool);
+        if (!thread) {
+            break;
+        }
+        pool->threads[pool->num_threads++] = thread;
+    }
+    if (pool->num_threads == 0) {
+        SW_DestroyTilePool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+static SDL_bool
+SW_RectsTouch(const SDL_Rect *a, const SDL_Rect *b)
+{
+    return ((a->x <= b->x + b->w) && (b->x <= a->x + a->w) &&
+            (a->y <= b->y + b->h) && (b->y <= a->y + a->h)) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Add an area of the window surface that needs to be presented. Rects that
+   overlap or share an edge are merged, so a frame's damage stays a short
+   list of disjoint rects. */
+static void
+SW_AddDamage(SW_RenderData *data, const SDL_Rect *rect)
+{
+    SDL_Rect merged = *rect;
+    int i;
+
+    if (data->damage_all || SDL_RectEmpty(rect)) {
+        return;
+    }
+
+    i = 0;
+    while (i < data->num_damage) {
+        if (SW_RectsTouch(&data->damage[i], &merged)) {
+            SDL_UnionRect(&data->damage[i], &merged, &merged);
+            data->damage[i] = data->damage[--data->num_damage];
+            i = 0;  /* the bigger rect may touch ones we already checked. */
+        } else {
+            i++;
+        }
+    }
+
+    if (data->num_damage == SW_MAX_DAMAGE_RECTS) {
+        for (i = 0; i < data->num_damage; i++) {
+            SDL_UnionRect(&data->damage[i], &merged, &merged);
+        }
+        data->num_damage = 0;
+    }
+    data->damage[data->num_damage++] = merged;
+}
+
+/* Add the area a draw command can touch, before it runs (blits clip their dstrect in place) */
+static void
+SW_AddCommandDamage(SW_RenderData *data, SDL_Surface *surface, const SDL_RenderCommand *cmd, void *vertices)
+{
+    const int count = (int) cmd->data.draw.count;
+    SDL_Rect bounds;
+    int i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+            data->damage_all = SDL_TRUE;
+            return;
+
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            if (!SDL_EnclosePoints(verts, count, NULL, &bounds)) {
+                return;
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            /* coalesced commands can be spread out, so keep their rects apart. */
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; i++) {
+                if (SDL_IntersectRect(&verts[i], &surface->clip_rect, &bounds)) {
+                    SW_AddDamage(data, &bounds);
+                }
+            }
+            return;
+        }
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            for (i = 0; i < count; i++) {
+                if (SDL_IntersectRect(&verts[i * 2 + 1], &surface->clip_rect, &bounds)) {  /* srcrect, dstrect pairs. */
+                    SW_AddDamage(data, &bounds);
+                }
+            }
+            return;
+        }
+
+        case SDL_RENDERCMD_COPY_EX: {
+            /* Whatever the angle, the copy stays within reach of the rotation center. */
+            const CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            const double cx = copydata->center.x;
+            const double cy = copydata->center.y;
+            const double dx = SDL_max(cx, copydata->dstrect.w - cx);
+            const double dy = SDL_max(cy, copydata->dstrect.h - cy);
+            const int radius = (int) SDL_ceil(SDL_sqrt(dx * dx + dy * dy)) + 1;
+            bounds.x = copydata->dstrect.x + (int) cx - radius;
+            bounds.y = copydata->dstrect.y + (int) cy - radius;
+            bounds.w = bounds.h = radius * 2 + 1;
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            const SDL_TriangleVertex *tverts = (SDL_TriangleVertex *) (((Uint8 *) vertices) + cmd->data.draw.first);
+            int minx, miny, maxx, maxy;
+            if (count <= 0) {
+                return;
+            }
+            minx = maxx = tverts[0].x;
+            miny = maxy = tverts[0].y;
+            for (i = 1; i < count; i++) {
+                minx = SDL_min(minx, tverts[i].x);
+                maxx = SDL_max(maxx, tverts[i].x);
+                miny = SDL_min(miny, tverts[i].y);
+                maxy = SDL_max(maxy, tverts[i].y);
+            }
+            bounds.x = (minx >> SDL_TRIANGLE_SUBPIXEL_BITS) - 1;
+            bounds.y = (miny >> SDL_TRIANGLE_SUBPIXEL_BITS) - 1;
+            bounds.w = (maxx >> SDL_TRIANGLE_SUBPIXEL_BITS) - bounds.x + 2;
+            bounds.h = (maxy >> SDL_TRIANGLE_SUBPIXEL_BITS) - bounds.y + 2;
+            break;
+        }
+
+        default:
+            return;
+    }
+
+    if (SDL_IntersectRect(&bounds, &surface->clip_rect, &bounds)) {
+        SW_AddDamage(data, &bounds);
+    }
+}
+
 static int
 SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_TilePool *tiles = data->tiles;
     const SDL_Rect *viewport = NULL;
     const SDL_Rect *cliprect = NULL;
 
@@ -580,7 +1434,20 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
         return -1;
     }
 
+    if (tiles && !SW_SetupTiles(tiles, surface, vertices)) {
+        tiles = NULL;
+    }
+
     while (cmd) {
+        if (surface == data->window && renderer->window) {
+            SW_AddCommandDamage(data, surface, cmd, vertices);
+        }
+
+        if (tiles && SW_TileCommand(tiles, cmd, vertices)) {
+            cmd = cmd->next;
+            continue;
+        }
+
         switch (cmd->command) {
             case SDL_RENDERCMD_SETDRAWCOLOR: {
                 break;  /* Not used in this backend. */
@@ -672,21 +1539,26 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
 
             case SDL_RENDERCMD_COPY: {
                 SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
+                const size_t count = cmd->data.draw.count;
                 SDL_Texture *texture = cmd->data.draw.texture;
                 SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+                size_t i;
 
                 PrepTextureForCopy(cmd);
 
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
-                } else {
-                    /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                     * to avoid potentially frequent RLE encoding/decoding.
-                     */
-                    SDL_SetSurfaceRLE(surface, 0);
-                    SDL_BlitScaled(src, srcrect, surface, dstrect);
+                /* coalesced copies are stored as consecutive srcrect/dstrect pairs. */
+                for (i = 0; i < count; i++, verts += 2) {
+                    const SDL_Rect *srcrect = verts;
+                    SDL_Rect *dstrect = verts + 1;
+                    if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
+                        SDL_BlitSurface(src, srcrect, surface, dstrect);
+                    } else {
+                        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+                         * to avoid potentially frequent RLE encoding/decoding.
+                         */
+                        SDL_SetSurfaceRLE(surface, 0);
+                        SDL_BlitScaled(src, srcrect, surface, dstrect);
+                    }
                 }
                 break;
             }
@@ -699,6 +1571,19 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
                 break;
             }
 
+            case SDL_RENDERCMD_GEOMETRY: {
+                const SDL_TriangleVertex *verts = (SDL_TriangleVertex *) (((Uint8 *) vertices) + cmd->data.draw.first);
+                const int count = (int) cmd->data.draw.count;
+                SDL_Texture *texture = cmd->data.draw.texture;
+                if (texture) {
+                    SDL_BlitTriangles((SDL_Surface *) texture->driverdata, surface, NULL, verts, count, cmd->data.draw.blend,
+                                      cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+                } else {
+                    SDL_FillTriangles(surface, NULL, verts, count, cmd->data.draw.blend);
+                }
+                break;
+            }
+
             case SDL_RENDERCMD_NO_OP:
                 break;
         }
@@ -706,6 +1591,10 @@ SW_RunCommandQueue(SDL_Renderer * renderer, SDL_RenderCommand *cmd, void *vertic
         cmd = cmd->next;
     }
 
+    if (tiles) {
+        SW_FlushTiles(tiles);
+    }
+
     return 0;
 }
 
@@ -743,10 +1632,18 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
 static void
 SW_RenderPresent(SDL_Renderer * renderer)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Window *window = renderer->window;
 
     if (window) {
-        SDL_UpdateWindowSurface(window);
+        /* Only push out what was drawn this frame, the rest is unchanged. */
+        if (data->damage_all) {
+            SDL_UpdateWindowSurface(window);
+        } else if (data->num_damage > 0) {
+            SDL_UpdateWindowSurfaceRects(window, data->damage, data->num_damage);
+        }
+        data->num_damage = 0;
+        data->damage_all = SDL_FALSE;
     }
 }
 
@@ -763,6 +1660,9 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data && data->tiles) {
+        SW_DestroyTilePool(data->tiles);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -792,9 +1692,12 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    data->damage_all = SDL_TRUE;
+    data->tiles = SW_CreateTilePool();
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
+    renderer->SupportsBlendMode = SW_SupportsBlendMode;
     renderer->CreateTexture = SW_CreateTexture;
     renderer->UpdateTexture = SW_UpdateTexture;
     renderer->LockTexture = SW_LockTexture;
@@ -807,6 +1710,8 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->QueueFillRects = SW_QueueFillRects;
     renderer->QueueCopy = SW_QueueCopy;
     renderer->QueueCopyEx = SW_QueueCopyEx;
+    renderer->QueueGeometry = SW_QueueGeometry;
+    renderer->TranslateCommand = SW_TranslateCommand;
     renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
@@ -814,6 +1719,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->DestroyRenderer = SW_DestroyRenderer;
     renderer->info = SW_RenderDriver.info;
     renderer->driverdata = data;
+    renderer->coalesce_commands = SDL_TRUE;
 
     SW_ActivateRenderer(renderer);
 
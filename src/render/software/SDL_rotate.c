@@ -454,7 +454,7 @@ SDLgfx_rotateSurface(SDL_Surface * src, double angle, int centerx, int centery,
         }
     } else {
         /* Target surface is 32 bit with source RGBA ordering */
-        rz_dst = SDL_CreateRGBSurface(0, dstwidth, dstheight + GUARD_ROWS, 32,
+        rz_dst = SDL_CreateRGBSurface(SDL_POOLED, dstwidth, dstheight + GUARD_ROWS, 32,
                                       src->format->Rmask, src->format->Gmask,
                                       src->format->Bmask, src->format->Amask);
     }
@@ -0,0 +1,470 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if !SDL_RENDER_DISABLED
+
+#include "SDL_draw.h"
+#include "SDL_triangle.h"
+
+/* Triangles are rasterized with edge functions (half-space tests) evaluated
+ * at pixel centers, using the usual top-left fill rule so that triangles
+ * sharing an edge never touch the same pixel twice. Rather than testing
+ * every pixel of the bounding box, the covered span of each row is solved
+ * directly from the three edge functions, and the vertex attributes are
+ * interpolated across the span from their screen space gradients.
+ */
+
+#define TRI_ONE         (1 << SDL_TRIANGLE_SUBPIXEL_BITS)
+#define TRI_HALF        (TRI_ONE / 2)
+
+enum
+{
+    TRI_ATTR_R,
+    TRI_ATTR_G,
+    TRI_ATTR_B,
+    TRI_ATTR_A,
+    TRI_ATTR_U,
+    TRI_ATTR_V,
+    TRI_ATTR_COUNT
+};
+
+typedef struct
+{
+    SDL_Rect bounds;                /* pixels to visit, already clipped */
+    int ox, oy;                     /* offset of the bounds from the attribute origin */
+    Sint64 w[3];                    /* edge functions at the first pixel center of the bounds */
+    Sint64 dx[3];                   /* edge function step per pixel */
+    Sint64 dy[3];                   /* edge function step per row */
+    Sint64 bias[3];                 /* top-left fill rule */
+    SDL_bool flat;                  /* all three vertices have the same color */
+    float attr[TRI_ATTR_COUNT];     /* attributes at the unclipped top left pixel center */
+    float attr_dx[TRI_ATTR_COUNT];
+    float attr_dy[TRI_ATTR_COUNT];
+} TriangleSetup;
+
+static SDL_INLINE Sint64
+EdgeFunction(const SDL_TriangleVertex *a, const SDL_TriangleVertex *b, Sint64 px, Sint64 py)
+{
+    return ((Sint64)b->x - a->x) * (py - a->y) - ((Sint64)b->y - a->y) * (px - a->x);
+}
+
+static SDL_INLINE Sint64
+EdgeBias(const SDL_TriangleVertex *a, const SDL_TriangleVertex *b)
+{
+    /* Pixel centers exactly on an edge belong to the triangle only for top and left edges. */
+    const int dx = b->x - a->x;
+    const int dy = b->y - a->y;
+    return (dy < 0 || (dy == 0 && dx > 0)) ? 0 : -1;
+}
+
+static SDL_bool
+SetupTriangle(const SDL_Rect * clip, const SDL_TriangleVertex * v0,
+              const SDL_TriangleVertex * v1, const SDL_TriangleVertex * v2,
+              const float mod[4], const SDL_Surface * src, TriangleSetup * t)
+{
+    const SDL_TriangleVertex *v[3];
+    float values[3][TRI_ATTR_COUNT];
+    Sint64 origin[3];
+    Sint64 area, px, py;
+    int minx, miny, maxx, maxy;
+    int originx, originy;
+    int i, j;
+
+    area = EdgeFunction(v0, v1, v2->x, v2->y);
+    if (area == 0) {
+        return SDL_FALSE;  /* degenerate, nothing to draw. */
+    }
+
+    /* Keep a consistent winding so the inside is where all edge functions are positive. */
+    v[0] = v0;
+    if (area > 0) {
+        v[1] = v1;
+        v[2] = v2;
+    } else {
+        v[1] = v2;
+        v[2] = v1;
+        area = -area;
+    }
+
+    /* Bounding box of the pixel centers covered, clipped to the surface clip rect */
+    minx = SDL_min(v0->x, SDL_min(v1->x, v2->x));
+    maxx = SDL_max(v0->x, SDL_max(v1->x, v2->x));
+    miny = SDL_min(v0->y, SDL_min(v1->y, v2->y));
+    maxy = SDL_max(v0->y, SDL_max(v1->y, v2->y));
+    minx = (minx + TRI_HALF - 1) >> SDL_TRIANGLE_SUBPIXEL_BITS;
+    miny = (miny + TRI_HALF - 1) >> SDL_TRIANGLE_SUBPIXEL_BITS;
+    maxx = (maxx - TRI_HALF) >> SDL_TRIANGLE_SUBPIXEL_BITS;
+    maxy = (maxy - TRI_HALF) >> SDL_TRIANGLE_SUBPIXEL_BITS;
+    originx = minx;
+    originy = miny;
+    minx = SDL_max(minx, clip->x);
+    miny = SDL_max(miny, clip->y);
+    maxx = SDL_min(maxx, clip->x + clip->w - 1);
+    maxy = SDL_min(maxy, clip->y + clip->h - 1);
+    if (minx > maxx || miny > maxy) {
+        return SDL_FALSE;
+    }
+    t->bounds.x = minx;
+    t->bounds.y = miny;
+    t->bounds.w = maxx - minx + 1;
+    t->bounds.h = maxy - miny + 1;
+    t->ox = minx - originx;
+    t->oy = miny - originy;
+
+    /* Edge i is opposite vertex i, so its function is the (scaled) barycentric weight of vertex i */
+    px = ((Sint64)minx * TRI_ONE) + TRI_HALF;
+    py = ((Sint64)miny * TRI_ONE) + TRI_HALF;
+    for (i = 0; i < 3; ++i) {
+        const SDL_TriangleVertex *a = v[(i + 1) % 3];
+        const SDL_TriangleVertex *b = v[(i + 2) % 3];
+        t->w[i] = EdgeFunction(a, b, px, py);
+        t->dx[i] = -((Sint64)b->y - a->y) * TRI_ONE;
+        t->dy[i] = ((Sint64)b->x - a->x) * TRI_ONE;
+        t->bias[i] = EdgeBias(a, b);
+        origin[i] = EdgeFunction(a, b, ((Sint64)originx * TRI_ONE) + TRI_HALF,
+                                 ((Sint64)originy * TRI_ONE) + TRI_HALF);
+    }
+
+    for (i = 0; i < 3; ++i) {
+        values[i][TRI_ATTR_R] = v[i]->color.r * mod[0];
+        values[i][TRI_ATTR_G] = v[i]->color.g * mod[1];
+        values[i][TRI_ATTR_B] = v[i]->color.b * mod[2];
+        values[i][TRI_ATTR_A] = v[i]->color.a * mod[3];
+        values[i][TRI_ATTR_U] = v[i]->u;
+        values[i][TRI_ATTR_V] = v[i]->v;
+    }
+    t->flat = (SDL_memcmp(&v[0]->color, &v[1]->color, sizeof (SDL_Color)) == 0 &&
+               SDL_memcmp(&v[0]->color, &v[2]->color, sizeof (SDL_Color)) == 0) ? SDL_TRUE : SDL_FALSE;
+
+    /* Attributes are interpolated from the unclipped bounds, so each pixel gets
+       the same value no matter how the triangle is clipped. */
+    for (j = 0; j < TRI_ATTR_COUNT; ++j) {
+        if (j >= TRI_ATTR_U && !src) {
+            t->attr[j] = t->attr_dx[j] = t->attr_dy[j] = 0.0f;
+            continue;
+        }
+        t->attr[j] = (float)((origin[0] * (double)values[0][j] + origin[1] * (double)values[1][j] + origin[2] * (double)values[2][j]) / area);
+        t->attr_dx[j] = (float)((t->dx[0] * (double)values[0][j] + t->dx[1] * (double)values[1][j] + t->dx[2] * (double)values[2][j]) / area);
+        t->attr_dy[j] = (float)((t->dy[0] * (double)values[0][j] + t->dy[1] * (double)values[1][j] + t->dy[2] * (double)values[2][j]) / area);
+    }
+    return SDL_TRUE;
+}
+
+/* Find the range [*x0, *x1] of pixels in the current row inside all three edges.
+   Returns SDL_FALSE if the row is empty. */
+static SDL_INLINE SDL_bool
+GetSpan(const TriangleSetup * t, const Sint64 w[3], int *x0, int *x1)
+{
+    Sint64 kmin = 0;
+    Sint64 kmax = t->bounds.w - 1;
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        const Sint64 value = w[i] + t->bias[i];
+        const Sint64 step = t->dx[i];
+        if (step > 0) {
+            if (value < 0) {
+                kmin = SDL_max(kmin, (-value + step - 1) / step);
+            }
+        } else if (step < 0) {
+            if (value < 0) {
+                return SDL_FALSE;
+            }
+            kmax = SDL_min(kmax, value / -step);
+        } else if (value < 0) {
+            return SDL_FALSE;
+        }
+    }
+    if (kmin > kmax) {
+        return SDL_FALSE;
+    }
+    *x0 = (int)kmin;
+    *x1 = (int)kmax;
+    return SDL_TRUE;
+}
+
+static SDL_INLINE Uint32
+ClampColor(float value)
+{
+    if (value <= 0.0f) {
+        return 0;
+    } else if (value >= 255.0f) {
+        return 255;
+    }
+    return (Uint32)(value + 0.5f);
+}
+
+/* Same blending arithmetic as SDL_Blit_Slow() */
+static SDL_INLINE void
+BlendPixel(Uint8 * pixel, int bpp, const SDL_PixelFormat * fmt, SDL_BlendMode blendMode,
+           Uint32 srcR, Uint32 srcG, Uint32 srcB, Uint32 srcA)
+{
+    Uint32 dstpixel;
+    Uint32 dstR, dstG, dstB, dstA;
+
+    if (blendMode == SDL_BLENDMODE_NONE) {
+        if (fmt->Amask) {
+            ASSEMBLE_RGBA(pixel, bpp, fmt, srcR, srcG, srcB, srcA);
+        } else {
+            ASSEMBLE_RGB(pixel, bpp, fmt, srcR, srcG, srcB);
+        }
+        return;
+    }
+
+    if (fmt->Amask) {
+        DISEMBLE_RGBA(pixel, bpp, fmt, dstpixel, dstR, dstG, dstB, dstA);
+    } else {
+        DISEMBLE_RGB(pixel, bpp, fmt, dstpixel, dstR, dstG, dstB);
+        dstA = 0xFF;
+    }
+
+    switch (blendMode) {
+    case SDL_BLENDMODE_BLEND:
+        srcR = (srcR * srcA) / 255;
+        srcG = (srcG * srcA) / 255;
+        srcB = (srcB * srcA) / 255;
+        dstR = srcR + ((255 - srcA) * dstR) / 255;
+        dstG = srcG + ((255 - srcA) * dstG) / 255;
+        dstB = srcB + ((255 - srcA) * dstB) / 255;
+        dstA = srcA + ((255 - srcA) * dstA) / 255;
+        break;
+    case SDL_BLENDMODE_ADD:
+        srcR = (srcR * srcA) / 255;
+        srcG = (srcG * srcA) / 255;
+        srcB = (srcB * srcA) / 255;
+        dstR = SDL_min(srcR + dstR, 255);
+        dstG = SDL_min(srcG + dstG, 255);
+        dstB = SDL_min(srcB + dstB, 255);
+        break;
+    case SDL_BLENDMODE_MOD:
+        dstR = (srcR * dstR) / 255;
+        dstG = (srcG * dstG) / 255;
+        dstB = (srcB * dstB) / 255;
+        break;
+    default:
+        break;
+    }
+
+    if (fmt->Amask) {
+        ASSEMBLE_RGBA(pixel, bpp, fmt, dstR, dstG, dstB, dstA);
+    } else {
+        ASSEMBLE_RGB(pixel, bpp, fmt, dstR, dstG, dstB);
+    }
+}
+
+static void
+FillTriangle(SDL_Surface * dst, const TriangleSetup * t, SDL_BlendMode blendMode)
+{
+    const SDL_PixelFormat *fmt = dst->format;
+    const int bpp = fmt->BytesPerPixel;
+    Uint8 *row = (Uint8 *)dst->pixels + t->bounds.y * dst->pitch + t->bounds.x * bpp;
+    Sint64 w[3];
+    int x, y, x0, x1;
+
+    w[0] = t->w[0];
+    w[1] = t->w[1];
+    w[2] = t->w[2];
+
+    for (y = 0; y < t->bounds.h; ++y, row += dst->pitch) {
+        if (GetSpan(t, w, &x0, &x1)) {
+            const int ay = y + t->oy;
+            const float r = t->attr[TRI_ATTR_R] + ay * t->attr_dy[TRI_ATTR_R];
+            const float g = t->attr[TRI_ATTR_G] + ay * t->attr_dy[TRI_ATTR_G];
+            const float b = t->attr[TRI_ATTR_B] + ay * t->attr_dy[TRI_ATTR_B];
+            const float a = t->attr[TRI_ATTR_A] + ay * t->attr_dy[TRI_ATTR_A];
+            Uint8 *pixel = row + x0 * bpp;
+
+            if (t->flat) {
+                const Uint32 R = ClampColor(r);
+                const Uint32 G = ClampColor(g);
+                const Uint32 B = ClampColor(b);
+                const Uint32 A = ClampColor(a);
+                for (x = x0; x <= x1; ++x, pixel += bpp) {
+                    BlendPixel(pixel, bpp, fmt, blendMode, R, G, B, A);
+                }
+            } else {
+                for (x = x0; x <= x1; ++x, pixel += bpp) {
+                    const int ax = x + t->ox;
+                    BlendPixel(pixel, bpp, fmt, blendMode,
+                               ClampColor(r + ax * t->attr_dx[TRI_ATTR_R]),
+                               ClampColor(g + ax * t->attr_dx[TRI_ATTR_G]),
+                               ClampColor(b + ax * t->attr_dx[TRI_ATTR_B]),
+                               ClampColor(a + ax * t->attr_dx[TRI_ATTR_A]));
+                }
+            }
+        }
+        w[0] += t->dy[0];
+        w[1] += t->dy[1];
+        w[2] += t->dy[2];
+    }
+}
+
+static void
+BlitTriangle(SDL_Surface * src, SDL_Surface * dst, const TriangleSetup * t, SDL_BlendMode blendMode)
+{
+    const SDL_PixelFormat *src_fmt = src->format;
+    const SDL_PixelFormat *fmt = dst->format;
+    const int srcbpp = src_fmt->BytesPerPixel;
+    const int bpp = fmt->BytesPerPixel;
+    const int maxu = src->w - 1;
+    const int maxv = src->h - 1;
+    Uint8 *row = (Uint8 *)dst->pixels + t->bounds.y * dst->pitch + t->bounds.x * bpp;
+    Sint64 w[3];
+    int x, y, x0, x1;
+
+    w[0] = t->w[0];
+    w[1] = t->w[1];
+    w[2] = t->w[2];
+
+    for (y = 0; y < t->bounds.h; ++y, row += dst->pitch) {
+        if (GetSpan(t, w, &x0, &x1)) {
+            float attr[TRI_ATTR_COUNT];
+            Uint8 *pixel = row + x0 * bpp;
+            int i;
+
+            for (i = 0; i < TRI_ATTR_COUNT; ++i) {
+                attr[i] = t->attr[i] + (y + t->oy) * t->attr_dy[i];
+            }
+
+            for (x = x0; x <= x1; ++x, pixel += bpp) {
+                const int ax = x + t->ox;
+                const float u = attr[TRI_ATTR_U] + ax * t->attr_dx[TRI_ATTR_U];
+                const float v = attr[TRI_ATTR_V] + ax * t->attr_dx[TRI_ATTR_V];
+                const int tu = (u <= 0.0f) ? 0 : SDL_min((int)u, maxu);
+                const int tv = (v <= 0.0f) ? 0 : SDL_min((int)v, maxv);
+                const Uint8 *texel = (const Uint8 *)src->pixels + tv * src->pitch + tu * srcbpp;
+                Uint32 srcpixel;
+                Uint32 srcR, srcG, srcB, srcA;
+
+                if (src_fmt->Amask) {
+                    DISEMBLE_RGBA(texel, srcbpp, src_fmt, srcpixel, srcR, srcG, srcB, srcA);
+                } else {
+                    DISEMBLE_RGB(texel, srcbpp, src_fmt, srcpixel, srcR, srcG, srcB);
+                    srcA = 0xFF;
+                }
+
+                srcR = (srcR * ClampColor(attr[TRI_ATTR_R] + ax * t->attr_dx[TRI_ATTR_R])) / 255;
+                srcG = (srcG * ClampColor(attr[TRI_ATTR_G] + ax * t->attr_dx[TRI_ATTR_G])) / 255;
+                srcB = (srcB * ClampColor(attr[TRI_ATTR_B] + ax * t->attr_dx[TRI_ATTR_B])) / 255;
+                srcA = (srcA * ClampColor(attr[TRI_ATTR_A] + ax * t->attr_dx[TRI_ATTR_A])) / 255;
+
+                BlendPixel(pixel, bpp, fmt, blendMode, srcR, srcG, srcB, srcA);
+            }
+        }
+        w[0] += t->dy[0];
+        w[1] += t->dy[1];
+        w[2] += t->dy[2];
+    }
+}
+
+int
+SDL_FillTriangles(SDL_Surface * dst, const SDL_Rect * cliprect, const SDL_TriangleVertex * verts, int count,
+                  SDL_BlendMode blendMode)
+{
+    static const float mod[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    TriangleSetup setup;
+    SDL_Rect clip;
+    int i;
+
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+    if (dst->format->BitsPerPixel < 8) {
+        return SDL_SetError("SDL_FillTriangles(): Unsupported surface format");
+    }
+
+    clip = dst->clip_rect;
+    if (cliprect && !SDL_IntersectRect(cliprect, &clip, &clip)) {
+        return 0;
+    }
+
+    if (SDL_MUSTLOCK(dst) && SDL_LockSurface(dst) < 0) {
+        return -1;
+    }
+
+    for (i = 0; i + 2 < count; i += 3) {
+        if (SetupTriangle(&clip, &verts[i], &verts[i + 1], &verts[i + 2], mod, NULL, &setup)) {
+            FillTriangle(dst, &setup, blendMode);
+        }
+    }
+
+    if (SDL_MUSTLOCK(dst)) {
+        SDL_UnlockSurface(dst);
+    }
+    return 0;
+}
+
+int
+SDL_BlitTriangles(SDL_Surface * src, SDL_Surface * dst, const SDL_Rect * cliprect, const SDL_TriangleVertex * verts,
+                  int count, SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    TriangleSetup setup;
+    SDL_Rect clip;
+    float mod[4];
+    int i;
+
+    if (!src || !dst) {
+        return SDL_SetError("Passed NULL surface");
+    }
+    if (src->format->BitsPerPixel < 8 || dst->format->BitsPerPixel < 8) {
+        return SDL_SetError("SDL_BlitTriangles(): Unsupported surface format");
+    }
+
+    clip = dst->clip_rect;
+    if (cliprect && !SDL_IntersectRect(cliprect, &clip, &clip)) {
+        return 0;
+    }
+
+    mod[0] = r / 255.0f;
+    mod[1] = g / 255.0f;
+    mod[2] = b / 255.0f;
+    mod[3] = a / 255.0f;
+
+    /* RLE encoded textures are decoded while locked */
+    if (SDL_MUSTLOCK(src) && SDL_LockSurface(src) < 0) {
+        return -1;
+    }
+    if (SDL_MUSTLOCK(dst) && SDL_LockSurface(dst) < 0) {
+        if (SDL_MUSTLOCK(src)) {
+            SDL_UnlockSurface(src);
+        }
+        return -1;
+    }
+
+    for (i = 0; i + 2 < count; i += 3) {
+        if (SetupTriangle(&clip, &verts[i], &verts[i + 1], &verts[i + 2], mod, src, &setup)) {
+            BlitTriangle(src, dst, &setup, blendMode);
+        }
+    }
+
+    if (SDL_MUSTLOCK(dst)) {
+        SDL_UnlockSurface(dst);
+    }
+    if (SDL_MUSTLOCK(src)) {
+        SDL_UnlockSurface(src);
+    }
+    return 0;
+}
+
+#endif /* !SDL_RENDER_DISABLED */
+
+/* vi: set ts=4 sw=4 expandtab: */
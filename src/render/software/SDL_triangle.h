@@ -0,0 +1,54 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_triangle_h_
+#define SDL_triangle_h_
+
+#include "../../SDL_internal.h"
+
+/* Number of fractional bits in SDL_TriangleVertex positions */
+#define SDL_TRIANGLE_SUBPIXEL_BITS  4
+
+/* A fully resolved triangle list vertex, as queued by the software renderer.
+   Positions are in destination surface coordinates, in fixed point.
+   Texture coordinates are in texels of the source surface. */
+typedef struct SDL_TriangleVertex
+{
+    int x, y;
+    SDL_Color color;
+    float u, v;
+} SDL_TriangleVertex;
+
+/* Fill a list of (count / 3) triangles with interpolated vertex colors.
+   If cliprect isn't NULL, drawing is further limited to that rectangle;
+   pixels inside it come out the same as with no extra clipping. */
+extern int SDL_FillTriangles(SDL_Surface * dst, const SDL_Rect * cliprect, const SDL_TriangleVertex * verts, int count,
+                             SDL_BlendMode blendMode);
+
+/* Draw a list of (count / 3) textured triangles, modulating the texels by
+   the interpolated vertex colors and the r, g, b, a modulation values */
+extern int SDL_BlitTriangles(SDL_Surface * src, SDL_Surface * dst, const SDL_Rect * cliprect,
+                             const SDL_TriangleVertex * verts, int count,
+                             SDL_BlendMode blendMode, Uint8 r, Uint8 g, Uint8 b, Uint8 a);
+
+#endif /* SDL_triangle_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -1431,8 +1431,8 @@ SDL_RLESurface(SDL_Surface * surface)
     /* Pass on combinations not supported */
     if ((flags & SDL_COPY_MODULATE_COLOR) ||
         ((flags & SDL_COPY_MODULATE_ALPHA) && surface->format->Amask) ||
-        (flags & (SDL_COPY_ADD | SDL_COPY_MOD)) ||
-        (flags & SDL_COPY_NEAREST)) {
+        (flags & (SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD)) ||
+        (flags & (SDL_COPY_NEAREST | SDL_COPY_LINEAR))) {
         return -1;
     }
 
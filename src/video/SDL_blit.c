@@ -26,6 +26,7 @@
 #include "SDL_blit_auto.h"
 #include "SDL_blit_copy.h"
 #include "SDL_blit_slow.h"
+#include "SDL_blit_threads.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
@@ -85,7 +86,7 @@ SDL_SoftBlit(SDL_Surface * src, SDL_Rect * srcrect,
         RunBlit = (SDL_BlitFunc) src->map->data;
 
         /* Run the actual software blit */
-        RunBlit(info);
+        SDL_RunBlit(RunBlit, info);
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -124,45 +125,64 @@ SDL_UseAltivecPrefetch()
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc
-SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                   SDL_BlitFuncEntry * entries)
+Uint32
+SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck;
-    static Uint32 features = 0xffffffff;
+    static Uint32 detected = 0xffffffff;
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
 
     /* Get the available CPU features */
-    if (features == 0xffffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    if (detected == 0xffffffff) {
+        Uint32 features = SDL_CPU_ANY;
 
-        features = SDL_CPU_ANY;
-
-        /* Allow an override for testing .. */
-        if (override) {
-            SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+        if (SDL_HasMMX()) {
+            features |= SDL_CPU_MMX;
+        }
+        if (SDL_Has3DNow()) {
+            features |= SDL_CPU_3DNOW;
+        }
+        if (SDL_HasSSE()) {
+            features |= SDL_CPU_SSE;
+        }
+        if (SDL_HasSSE2()) {
+            features |= SDL_CPU_SSE2;
+        }
+        if (SDL_HasSSE41()) {
+            features |= SDL_CPU_SSE41;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
+        if (SDL_HasAltiVec()) {
+            if (SDL_UseAltivecPrefetch()) {
+                features |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
+        detected = features;
     }
 
+    /* Allow an override for testing .. it's checked every time, so the
+       SIMD blitters can be compared with the C ones in one run */
+    if (override) {
+        Uint32 features = SDL_CPU_ANY;
+        SDL_sscanf(override, "%u", &features);
+        return (detected & features);
+    }
+    return detected;
+}
+
+static SDL_BlitFunc
+SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                   SDL_BlitFuncEntry * entries)
+{
+    int i, flagcheck;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
+
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
         if (src_format != entries[i].src_format) {
@@ -182,7 +202,7 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
         /* Check blend flags */
         flagcheck =
             (flags &
-             (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD));
+             (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD));
         if ((flagcheck & entries[i].flags) != flagcheck) {
             continue;
         }
@@ -243,7 +263,7 @@ SDL_CalculateBlit(SDL_Surface * surface)
     }
 
     /* Choose a standard blit function */
-    if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
+    if (map->identity && !(map->info.flags & ~(SDL_COPY_RLE_DESIRED | SDL_COPY_LINEAR))) {
         blit = SDL_BlitCopy;
     } else if (surface->format->Rloss > 8 || dst->format->Rloss > 8) {
         /* Greater than 8 bits per channel not supported yet */
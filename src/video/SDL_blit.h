@@ -36,8 +36,10 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_COPY_BLEND              0x00000010
 #define SDL_COPY_ADD                0x00000020
 #define SDL_COPY_MOD                0x00000040
+#define SDL_COPY_BLEND_PREMULTIPLIED 0x00000080
 #define SDL_COPY_COLORKEY           0x00000100
 #define SDL_COPY_NEAREST            0x00000200
+#define SDL_COPY_LINEAR             0x00000400
 #define SDL_COPY_RLE_DESIRED        0x00001000
 #define SDL_COPY_RLE_COLORKEY       0x00002000
 #define SDL_COPY_RLE_ALPHAKEY       0x00004000
@@ -51,6 +53,39 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_AVX2                0x00000040
+#define SDL_CPU_NEON                0x00000080
+#define SDL_CPU_SSE41               0x00000100
+
+/* SIMD blitters.  SSE2 and NEON kernels are built when the compiler targets
+   them, SSE4.1, AVX, AVX2 and AVX-512 kernels are built with a target
+   attribute and only used after checking SDL_HasSSE41(), SDL_HasAVX(),
+   SDL_HasAVX2() or SDL_HasAVX512F() at runtime.
+*/
+#if defined(__SSE2__)
+#define HAVE_SSE2_INTRINSICS 1
+#endif
+#if defined(__ARM_NEON)
+#define HAVE_NEON_INTRINSICS 1
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H) && \
+    (defined(__clang__) || (defined(__GNUC__) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))))
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#define HAVE_AVX512F_INTRINSICS 1
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#elif defined(_MSC_VER) && (_MSC_VER >= 1700) && (defined(_M_X64) || defined(_M_IX86))
+#define HAVE_SSE41_INTRINSICS 1
+#define HAVE_AVX_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#if _MSC_VER >= 1910
+#define HAVE_AVX512F_INTRINSICS 1
+#endif
+#endif
+#ifndef SDL_TARGETING
+#define SDL_TARGETING(x)
+#endif
 
 typedef struct
 {
@@ -83,6 +118,27 @@ typedef struct
 } SDL_BlitFuncEntry;
 
 /* Blit mapping definition */
+/* A mapping to a destination format that isn't the current one, kept so
+   that blitting alternately to several destinations doesn't rebuild the
+   color tables and pick the blitter again every time.
+ */
+#define SDL_BLITMAP_CACHE_SIZE  4
+
+typedef struct SDL_BlitMapCache
+{
+    SDL_PixelFormat *dst_fmt;   /* we hold a reference to this format */
+    SDL_Palette *dst_palette;
+    Uint32 dst_palette_version;
+    Uint32 src_palette_version;
+    Uint32 cpu_features;
+    int flags;
+    Uint8 r, g, b, a;
+    int identity;
+    SDL_blit blit;
+    void *data;
+    Uint8 *table;
+} SDL_BlitMapCache;
+
 typedef struct SDL_BlitMap
 {
     SDL_Surface *dst;
@@ -95,17 +151,34 @@ typedef struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* the SDL_GetBlitCPUFeatures() the blitter was chosen for */
+    Uint32 cpu_features;
+
+    /* previous destinations, most recently used first */
+    SDL_BlitMapCache cache[SDL_BLITMAP_CACHE_SIZE];
+    int num_cached;
 } SDL_BlitMap;
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
 
+/* The SDL_CPU_* features blitters may use. When the SDL_BLIT_CPU_FEATURES
+   environment variable is set, only the features in that mask are used,
+   so "0" selects the C blitters. */
+extern Uint32 SDL_GetBlitCPUFeatures(void);
+
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface * surface);
 
+/* Functions found in SDL_stretch.c */
+extern SDL_bool SDL_SoftStretchLinearSupported(const SDL_PixelFormat * format);
+extern int SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                                 SDL_Surface * dst, const SDL_Rect * dstrect);
+
 /*
  * Useful macros for blitting routines
  */
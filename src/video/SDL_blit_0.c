@@ -464,7 +464,7 @@ SDL_CalculateBlit0(SDL_Surface * surface)
     } else {
         which = surface->map->dst->format->BytesPerPixel;
     }
-    switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
+    switch (surface->map->info.flags & ~(SDL_COPY_RLE_MASK | SDL_COPY_LINEAR)) {
     case 0:
         return bitmap_blit[which];
 
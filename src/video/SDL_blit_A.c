@@ -389,6 +389,66 @@ BlitRGBtoRGBPixelAlphaMMX(SDL_BlitInfo * info)
 
 #endif /* __MMX__ */
 
+/* blend a single RGB888 pixel at 50%, setting the unused byte */
+static SDL_INLINE Uint32
+BlendRGBSurfaceAlpha128(Uint32 s, Uint32 d)
+{
+    return ((((s & 0x00fefefe) + (d & 0x00fefefe)) >> 1)
+            + (s & d & 0x00010101)) | 0xff000000;
+}
+
+/* blend a single RGB888 pixel with surface alpha, setting the unused byte */
+static SDL_INLINE Uint32
+BlendRGBSurfaceAlpha(Uint32 s, Uint32 d, Uint32 alpha)
+{
+    Uint32 s1 = s & 0xff00ff;
+    Uint32 d1 = d & 0xff00ff;
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
+    s &= 0xff00;
+    d &= 0xff00;
+    d = (d + ((s - d) * alpha >> 8)) & 0xff00;
+    return d1 | d | 0xff000000;
+}
+
+/* blend a single ARGB8888 pixel with its alpha onto an (A)RGB8888 pixel */
+static SDL_INLINE Uint32
+BlendRGBPixelAlpha(Uint32 s, Uint32 d)
+{
+    Uint32 alpha = s >> 24;
+    Uint32 dalpha;
+    Uint32 s1;
+    Uint32 d1;
+
+    /* FIXME: Here we special-case opaque alpha since the
+       compositioning used (>>8 instead of /255) doesn't handle
+       it correctly. Also special-case alpha=0 for speed?
+       Benchmark this! */
+    if (!alpha) {
+        return d;
+    } else if (alpha == SDL_ALPHA_OPAQUE) {
+        return s;
+    }
+
+    /*
+     * take out the middle component (green), and process
+     * the other two in parallel. One multiply less.
+     */
+    dalpha = d >> 24;
+    s1 = s & 0xff00ff;
+    d1 = d & 0xff00ff;
+    d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
+    s &= 0xff00;
+    d &= 0xff00;
+    d = (d + ((s - d) * alpha >> 8)) & 0xff00;
+    dalpha = alpha + (dalpha * (alpha ^ 0xFF) >> 8);
+    return d1 | d | (dalpha << 24);
+}
+
+/* RGBA8888 style pixels are rotated to put alpha in the top byte, so they
+   can share the ARGB8888 blending */
+#define ROTATE_ALPHA_TO_TOP(p)      (((p) >> 8) | ((p) << 24))
+#define ROTATE_ALPHA_TO_BOTTOM(p)   (((p) << 8) | ((p) >> 24))
+
 /* fast RGB888->(A)RGB888 blending with surface alpha=128 special case */
 static void
 BlitRGBtoRGBSurfaceAlpha128(SDL_BlitInfo * info)
@@ -403,10 +463,9 @@ BlitRGBtoRGBSurfaceAlpha128(SDL_BlitInfo * info)
     while (height--) {
         /* *INDENT-OFF* */
         DUFFS_LOOP4({
-            Uint32 s = *srcp++;
-            Uint32 d = *dstp;
-            *dstp++ = ((((s & 0x00fefefe) + (d & 0x00fefefe)) >> 1)
-                   + (s & d & 0x00010101)) | 0xff000000;
+            *dstp = BlendRGBSurfaceAlpha128(*srcp, *dstp);
+            ++srcp;
+            ++dstp;
         }, width);
         /* *INDENT-ON* */
         srcp += srcskip;
@@ -428,24 +487,11 @@ BlitRGBtoRGBSurfaceAlpha(SDL_BlitInfo * info)
         int srcskip = info->src_skip >> 2;
         Uint32 *dstp = (Uint32 *) info->dst;
         int dstskip = info->dst_skip >> 2;
-        Uint32 s;
-        Uint32 d;
-        Uint32 s1;
-        Uint32 d1;
 
         while (height--) {
             /* *INDENT-OFF* */
             DUFFS_LOOP4({
-                s = *srcp;
-                d = *dstp;
-                s1 = s & 0xff00ff;
-                d1 = d & 0xff00ff;
-                d1 = (d1 + ((s1 - d1) * alpha >> 8))
-                     & 0xff00ff;
-                s &= 0xff00;
-                d &= 0xff00;
-                d = (d + ((s - d) * alpha >> 8)) & 0xff00;
-                *dstp = d1 | d | 0xff000000;
+                *dstp = BlendRGBSurfaceAlpha(*srcp, *dstp, alpha);
                 ++srcp;
                 ++dstp;
             }, width);
@@ -470,35 +516,35 @@ BlitRGBtoRGBPixelAlpha(SDL_BlitInfo * info)
     while (height--) {
         /* *INDENT-OFF* */
         DUFFS_LOOP4({
-        Uint32 dalpha;
-        Uint32 d;
-        Uint32 s1;
-        Uint32 d1;
+        *dstp = BlendRGBPixelAlpha(*srcp, *dstp);
+        ++srcp;
+        ++dstp;
+        }, width);
+        /* *INDENT-ON* */
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* fast RGBA888->RGB(A)888 blending with pixel alpha */
+static void
+BlitRGBAtoRGBAPixelAlpha(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+
+    while (height--) {
+        /* *INDENT-OFF* */
+        DUFFS_LOOP4({
         Uint32 s = *srcp;
-        Uint32 alpha = s >> 24;
-        /* FIXME: Here we special-case opaque alpha since the
-           compositioning used (>>8 instead of /255) doesn't handle
-           it correctly. Also special-case alpha=0 for speed?
-           Benchmark this! */
-        if (alpha) {
-          if (alpha == SDL_ALPHA_OPAQUE) {
-              *dstp = *srcp;
-          } else {
-            /*
-             * take out the middle component (green), and process
-             * the other two in parallel. One multiply less.
-             */
-            d = *dstp;
-            dalpha = d >> 24;
-            s1 = s & 0xff00ff;
-            d1 = d & 0xff00ff;
-            d1 = (d1 + ((s1 - d1) * alpha >> 8)) & 0xff00ff;
-            s &= 0xff00;
-            d &= 0xff00;
-            d = (d + ((s - d) * alpha >> 8)) & 0xff00;
-            dalpha = alpha + (dalpha * (alpha ^ 0xFF) >> 8);
-            *dstp = d1 | d | (dalpha << 24);
-          }
+        if (s & 0xff) {
+            Uint32 d = *dstp;
+            d = BlendRGBPixelAlpha(ROTATE_ALPHA_TO_TOP(s), ROTATE_ALPHA_TO_TOP(d));
+            *dstp = ROTATE_ALPHA_TO_BOTTOM(d);
         }
         ++srcp;
         ++dstp;
@@ -582,6 +628,395 @@ BlitRGBtoRGBPixelAlphaMMX3DNOW(SDL_BlitInfo * info)
 
 #endif /* __3dNOW__ */
 
+/* The SIMD blitters below do exactly what BlendRGBPixelAlpha() and
+   BlendRGBSurfaceAlpha() do, one pixel per 32-bit lane, so the result
+   doesn't depend on the CPU. */
+
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+/* BlendRGBPixelAlpha() with alpha in the top or bottom byte, for leftover pixels */
+static SDL_INLINE Uint32
+BlendRGBPixelAlphaAt(Uint32 s, Uint32 d, int ashift)
+{
+    if (ashift == 0) {
+        d = BlendRGBPixelAlpha(ROTATE_ALPHA_TO_TOP(s), ROTATE_ALPHA_TO_TOP(d));
+        return ROTATE_ALPHA_TO_BOTTOM(d);
+    }
+    return BlendRGBPixelAlpha(s, d);
+}
+#endif
+
+#if HAVE_SSE41_INTRINSICS
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1")
+BlendRGBPixelAlphaSSE41(__m128i s, __m128i d)
+{
+    const __m128i rbmask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i gmask = _mm_set1_epi32(0x0000ff00);
+    const __m128i ff = _mm_set1_epi32(0xff);
+    const __m128i alpha = _mm_srli_epi32(s, 24);
+    __m128i rb = _mm_and_si128(d, rbmask);
+    __m128i g = _mm_and_si128(d, gmask);
+    __m128i a;
+
+    rb = _mm_add_epi32(rb, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(_mm_and_si128(s, rbmask), rb), alpha), 8));
+    g = _mm_add_epi32(g, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(_mm_and_si128(s, gmask), g), alpha), 8));
+    a = _mm_add_epi32(alpha, _mm_srli_epi32(_mm_mullo_epi32(_mm_srli_epi32(d, 24), _mm_xor_si128(alpha, ff)), 8));
+    a = _mm_or_si128(_mm_or_si128(_mm_and_si128(rb, rbmask), _mm_and_si128(g, gmask)), _mm_slli_epi32(a, 24));
+
+    /* Opaque pixels are copied and transparent ones are left alone */
+    a = _mm_blendv_epi8(a, s, _mm_cmpeq_epi32(alpha, ff));
+    return _mm_blendv_epi8(a, d, _mm_cmpeq_epi32(alpha, _mm_setzero_si128()));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1")
+BlendRGBSurfaceAlphaSSE41(__m128i s, __m128i d, __m128i alpha)
+{
+    const __m128i rbmask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i gmask = _mm_set1_epi32(0x0000ff00);
+    __m128i rb = _mm_and_si128(d, rbmask);
+    __m128i g = _mm_and_si128(d, gmask);
+
+    rb = _mm_add_epi32(rb, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(_mm_and_si128(s, rbmask), rb), alpha), 8));
+    g = _mm_add_epi32(g, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(_mm_and_si128(s, gmask), g), alpha), 8));
+    return _mm_or_si128(_mm_or_si128(_mm_and_si128(rb, rbmask), _mm_and_si128(g, gmask)),
+                        _mm_set1_epi32(0xff000000));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1")
+BlendRGBSurfaceAlpha128SSE41(__m128i s, __m128i d)
+{
+    const __m128i fe = _mm_set1_epi32(0x00fefefe);
+    __m128i half = _mm_srli_epi32(_mm_add_epi32(_mm_and_si128(s, fe), _mm_and_si128(d, fe)), 1);
+    half = _mm_add_epi32(half, _mm_and_si128(_mm_and_si128(s, d), _mm_set1_epi32(0x00010101)));
+    return _mm_or_si128(half, _mm_set1_epi32(0xff000000));
+}
+
+/* ARGB8888 or RGBA8888 style blending with pixel alpha, four pixels at a time */
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBPixelAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const int ashift = info->src_fmt->Ashift;
+    const __m128i amask = _mm_set1_epi32(info->src_fmt->Amask);
+
+    while (height--) {
+        int n = width;
+        for (; n >= 4; n -= 4, srcp += 4, dstp += 4) {
+            __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i a = _mm_and_si128(s, amask);
+            __m128i d;
+
+            if (_mm_testz_si128(a, a)) {
+                continue;
+            }
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(a, amask)) == 0xffff) {
+                _mm_storeu_si128((__m128i *) dstp, s);
+                continue;
+            }
+            d = _mm_loadu_si128((const __m128i *) dstp);
+            if (ashift == 0) {
+                s = _mm_or_si128(_mm_srli_epi32(s, 8), _mm_slli_epi32(s, 24));
+                d = _mm_or_si128(_mm_srli_epi32(d, 8), _mm_slli_epi32(d, 24));
+                d = BlendRGBPixelAlphaSSE41(s, d);
+                d = _mm_or_si128(_mm_slli_epi32(d, 8), _mm_srli_epi32(d, 24));
+            } else {
+                d = BlendRGBPixelAlphaSSE41(s, d);
+            }
+            _mm_storeu_si128((__m128i *) dstp, d);
+        }
+        for (; n > 0; --n, ++srcp, ++dstp) {
+            *dstp = BlendRGBPixelAlphaAt(*srcp, *dstp, ashift);
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* RGB888->(A)RGB888 blending with surface alpha, four pixels at a time */
+static void SDL_TARGETING("sse4.1")
+BlitRGBtoRGBSurfaceAlphaSSE41(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const Uint32 alpha = info->a;
+    const __m128i valpha = _mm_set1_epi32(alpha);
+
+    while (height--) {
+        int n = width;
+        for (; n >= 4; n -= 4, srcp += 4, dstp += 4) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) srcp);
+            const __m128i d = _mm_loadu_si128((const __m128i *) dstp);
+            if (alpha == 128) {
+                _mm_storeu_si128((__m128i *) dstp, BlendRGBSurfaceAlpha128SSE41(s, d));
+            } else {
+                _mm_storeu_si128((__m128i *) dstp, BlendRGBSurfaceAlphaSSE41(s, d, valpha));
+            }
+        }
+        for (; n > 0; --n, ++srcp, ++dstp) {
+            if (alpha == 128) {
+                *dstp = BlendRGBSurfaceAlpha128(*srcp, *dstp);
+            } else {
+                *dstp = BlendRGBSurfaceAlpha(*srcp, *dstp, alpha);
+            }
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+BlendRGBPixelAlphaAVX2(__m256i s, __m256i d)
+{
+    const __m256i rbmask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i gmask = _mm256_set1_epi32(0x0000ff00);
+    const __m256i ff = _mm256_set1_epi32(0xff);
+    const __m256i alpha = _mm256_srli_epi32(s, 24);
+    __m256i rb = _mm256_and_si256(d, rbmask);
+    __m256i g = _mm256_and_si256(d, gmask);
+    __m256i a;
+
+    rb = _mm256_add_epi32(rb, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(_mm256_and_si256(s, rbmask), rb), alpha), 8));
+    g = _mm256_add_epi32(g, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(_mm256_and_si256(s, gmask), g), alpha), 8));
+    a = _mm256_add_epi32(alpha, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(d, 24), _mm256_xor_si256(alpha, ff)), 8));
+    a = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(rb, rbmask), _mm256_and_si256(g, gmask)), _mm256_slli_epi32(a, 24));
+
+    /* Opaque pixels are copied and transparent ones are left alone */
+    a = _mm256_blendv_epi8(a, s, _mm256_cmpeq_epi32(alpha, ff));
+    return _mm256_blendv_epi8(a, d, _mm256_cmpeq_epi32(alpha, _mm256_setzero_si256()));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+BlendRGBSurfaceAlphaAVX2(__m256i s, __m256i d, __m256i alpha)
+{
+    const __m256i rbmask = _mm256_set1_epi32(0x00ff00ff);
+    const __m256i gmask = _mm256_set1_epi32(0x0000ff00);
+    __m256i rb = _mm256_and_si256(d, rbmask);
+    __m256i g = _mm256_and_si256(d, gmask);
+
+    rb = _mm256_add_epi32(rb, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(_mm256_and_si256(s, rbmask), rb), alpha), 8));
+    g = _mm256_add_epi32(g, _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_sub_epi32(_mm256_and_si256(s, gmask), g), alpha), 8));
+    return _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(rb, rbmask), _mm256_and_si256(g, gmask)),
+                           _mm256_set1_epi32(0xff000000));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+BlendRGBSurfaceAlpha128AVX2(__m256i s, __m256i d)
+{
+    const __m256i fe = _mm256_set1_epi32(0x00fefefe);
+    __m256i half = _mm256_srli_epi32(_mm256_add_epi32(_mm256_and_si256(s, fe), _mm256_and_si256(d, fe)), 1);
+    half = _mm256_add_epi32(half, _mm256_and_si256(_mm256_and_si256(s, d), _mm256_set1_epi32(0x00010101)));
+    return _mm256_or_si256(half, _mm256_set1_epi32(0xff000000));
+}
+
+/* ARGB8888 or RGBA8888 style blending with pixel alpha, eight pixels at a time */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const int ashift = info->src_fmt->Ashift;
+    const __m256i amask = _mm256_set1_epi32(info->src_fmt->Amask);
+
+    while (height--) {
+        int n = width;
+        for (; n >= 8; n -= 8, srcp += 8, dstp += 8) {
+            __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            const __m256i a = _mm256_and_si256(s, amask);
+            __m256i d;
+
+            if (_mm256_testz_si256(a, a)) {
+                continue;
+            }
+            if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, amask)) == -1) {
+                _mm256_storeu_si256((__m256i *) dstp, s);
+                continue;
+            }
+            d = _mm256_loadu_si256((const __m256i *) dstp);
+            if (ashift == 0) {
+                s = _mm256_or_si256(_mm256_srli_epi32(s, 8), _mm256_slli_epi32(s, 24));
+                d = _mm256_or_si256(_mm256_srli_epi32(d, 8), _mm256_slli_epi32(d, 24));
+                d = BlendRGBPixelAlphaAVX2(s, d);
+                d = _mm256_or_si256(_mm256_slli_epi32(d, 8), _mm256_srli_epi32(d, 24));
+            } else {
+                d = BlendRGBPixelAlphaAVX2(s, d);
+            }
+            _mm256_storeu_si256((__m256i *) dstp, d);
+        }
+        for (; n > 0; --n, ++srcp, ++dstp) {
+            *dstp = BlendRGBPixelAlphaAt(*srcp, *dstp, ashift);
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* RGB888->(A)RGB888 blending with surface alpha, eight pixels at a time */
+static void SDL_TARGETING("avx2")
+BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const Uint32 alpha = info->a;
+    const __m256i valpha = _mm256_set1_epi32(alpha);
+
+    while (height--) {
+        int n = width;
+        for (; n >= 8; n -= 8, srcp += 8, dstp += 8) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) srcp);
+            const __m256i d = _mm256_loadu_si256((const __m256i *) dstp);
+            if (alpha == 128) {
+                _mm256_storeu_si256((__m256i *) dstp, BlendRGBSurfaceAlpha128AVX2(s, d));
+            } else {
+                _mm256_storeu_si256((__m256i *) dstp, BlendRGBSurfaceAlphaAVX2(s, d, valpha));
+            }
+        }
+        for (; n > 0; --n, ++srcp, ++dstp) {
+            if (alpha == 128) {
+                *dstp = BlendRGBSurfaceAlpha128(*srcp, *dstp);
+            } else {
+                *dstp = BlendRGBSurfaceAlpha(*srcp, *dstp, alpha);
+            }
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static SDL_INLINE uint32x4_t
+BlendRGBPixelAlphaNEON(uint32x4_t s, uint32x4_t d)
+{
+    const uint32x4_t rbmask = vdupq_n_u32(0x00ff00ff);
+    const uint32x4_t gmask = vdupq_n_u32(0x0000ff00);
+    const uint32x4_t ff = vdupq_n_u32(0xff);
+    const uint32x4_t alpha = vshrq_n_u32(s, 24);
+    uint32x4_t rb = vandq_u32(d, rbmask);
+    uint32x4_t g = vandq_u32(d, gmask);
+    uint32x4_t a;
+
+    rb = vaddq_u32(rb, vshrq_n_u32(vmulq_u32(vsubq_u32(vandq_u32(s, rbmask), rb), alpha), 8));
+    g = vaddq_u32(g, vshrq_n_u32(vmulq_u32(vsubq_u32(vandq_u32(s, gmask), g), alpha), 8));
+    a = vaddq_u32(alpha, vshrq_n_u32(vmulq_u32(vshrq_n_u32(d, 24), veorq_u32(alpha, ff)), 8));
+    a = vorrq_u32(vorrq_u32(vandq_u32(rb, rbmask), vandq_u32(g, gmask)), vshlq_n_u32(a, 24));
+
+    /* Opaque pixels are copied and transparent ones are left alone */
+    a = vbslq_u32(vceqq_u32(alpha, ff), s, a);
+    return vbslq_u32(vceqq_u32(alpha, vdupq_n_u32(0)), d, a);
+}
+
+static SDL_INLINE uint32x4_t
+BlendRGBSurfaceAlphaNEON(uint32x4_t s, uint32x4_t d, uint32x4_t alpha)
+{
+    const uint32x4_t rbmask = vdupq_n_u32(0x00ff00ff);
+    const uint32x4_t gmask = vdupq_n_u32(0x0000ff00);
+    uint32x4_t rb = vandq_u32(d, rbmask);
+    uint32x4_t g = vandq_u32(d, gmask);
+
+    rb = vaddq_u32(rb, vshrq_n_u32(vmulq_u32(vsubq_u32(vandq_u32(s, rbmask), rb), alpha), 8));
+    g = vaddq_u32(g, vshrq_n_u32(vmulq_u32(vsubq_u32(vandq_u32(s, gmask), g), alpha), 8));
+    return vorrq_u32(vorrq_u32(vandq_u32(rb, rbmask), vandq_u32(g, gmask)), vdupq_n_u32(0xff000000));
+}
+
+static SDL_INLINE uint32x4_t
+BlendRGBSurfaceAlpha128NEON(uint32x4_t s, uint32x4_t d)
+{
+    const uint32x4_t fe = vdupq_n_u32(0x00fefefe);
+    uint32x4_t half = vshrq_n_u32(vaddq_u32(vandq_u32(s, fe), vandq_u32(d, fe)), 1);
+    half = vaddq_u32(half, vandq_u32(vandq_u32(s, d), vdupq_n_u32(0x00010101)));
+    return vorrq_u32(half, vdupq_n_u32(0xff000000));
+}
+
+/* ARGB8888 or RGBA8888 style blending with pixel alpha, four pixels at a time */
+static void
+BlitRGBtoRGBPixelAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const int ashift = info->src_fmt->Ashift;
+
+    while (height--) {
+        int n = width;
+        for (; n >= 4; n -= 4, srcp += 4, dstp += 4) {
+            uint32x4_t s = vld1q_u32(srcp);
+            uint32x4_t d = vld1q_u32(dstp);
+            if (ashift == 0) {
+                s = vorrq_u32(vshrq_n_u32(s, 8), vshlq_n_u32(s, 24));
+                d = vorrq_u32(vshrq_n_u32(d, 8), vshlq_n_u32(d, 24));
+                d = BlendRGBPixelAlphaNEON(s, d);
+                d = vorrq_u32(vshlq_n_u32(d, 8), vshrq_n_u32(d, 24));
+            } else {
+                d = BlendRGBPixelAlphaNEON(s, d);
+            }
+            vst1q_u32(dstp, d);
+        }
+        for (; n > 0; --n, ++srcp, ++dstp) {
+            *dstp = BlendRGBPixelAlphaAt(*srcp, *dstp, ashift);
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+
+/* RGB888->(A)RGB888 blending with surface alpha, four pixels at a time */
+static void
+BlitRGBtoRGBSurfaceAlphaNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *) info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *) info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const Uint32 alpha = info->a;
+    const uint32x4_t valpha = vdupq_n_u32(alpha);
+
+    while (height--) {
+        int n = width;
+        for (; n >= 4; n -= 4, srcp += 4, dstp += 4) {
+            const uint32x4_t s = vld1q_u32(srcp);
+            const uint32x4_t d = vld1q_u32(dstp);
+            if (alpha == 128) {
+                vst1q_u32(dstp, BlendRGBSurfaceAlpha128NEON(s, d));
+            } else {
+                vst1q_u32(dstp, BlendRGBSurfaceAlphaNEON(s, d, valpha));
+            }
+        }
+        for (; n > 0; --n, ++srcp, ++dstp) {
+            if (alpha == 128) {
+                *dstp = BlendRGBSurfaceAlpha128(*srcp, *dstp);
+            } else {
+                *dstp = BlendRGBSurfaceAlpha(*srcp, *dstp, alpha);
+            }
+        }
+        srcp += srcskip;
+        dstp += dstskip;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
 /* 16bpp special case for per-surface alpha=50%: blend 2 pixels in parallel */
 
 /* blend a single 16 bit pixel at 50% */
@@ -1270,8 +1705,9 @@ SDL_CalculateBlitA(SDL_Surface * surface)
 {
     SDL_PixelFormat *sf = surface->format;
     SDL_PixelFormat *df = surface->map->dst->format;
+    const Uint32 features = SDL_GetBlitCPUFeatures();
 
-    switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
+    switch (surface->map->info.flags & ~(SDL_COPY_RLE_MASK | SDL_COPY_LINEAR)) {
     case SDL_COPY_BLEND:
         /* Per-pixel alpha blits */
         switch (df->BytesPerPixel) {
@@ -1299,17 +1735,36 @@ SDL_CalculateBlitA(SDL_Surface * surface)
             if (sf->Rmask == df->Rmask
                 && sf->Gmask == df->Gmask
                 && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+                if (sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0
+                    && (sf->Ashift == 24 || sf->Ashift == 0) && sf->Aloss == 0) {
+#if HAVE_AVX2_INTRINSICS
+                    if (features & SDL_CPU_AVX2)
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                    if (features & SDL_CPU_SSE41)
+                        return BlitRGBtoRGBPixelAlphaSSE41;
+#endif
+#if HAVE_NEON_INTRINSICS
+                    if (features & SDL_CPU_NEON)
+                        return BlitRGBtoRGBPixelAlphaNEON;
+#endif
+                }
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS */
 #if defined(__MMX__) || defined(__3dNOW__)
                 if (sf->Rshift % 8 == 0
                     && sf->Gshift % 8 == 0
                     && sf->Bshift % 8 == 0
                     && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
 #ifdef __3dNOW__
-                    if (SDL_Has3DNow())
+                    if (features & SDL_CPU_3DNOW)
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
 #endif
 #ifdef __MMX__
-                    if (SDL_HasMMX())
+                    if (features & SDL_CPU_MMX)
                         return BlitRGBtoRGBPixelAlphaMMX;
 #endif
                 }
@@ -1317,6 +1772,12 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Amask == 0xff000000) {
                     return BlitRGBtoRGBPixelAlpha;
                 }
+                if (sf->Amask == 0x000000ff
+                    && sf->Rshift % 8 == 0
+                    && sf->Gshift % 8 == 0
+                    && sf->Bshift % 8 == 0) {
+                    return BlitRGBAtoRGBAPixelAlpha;
+                }
             }
             return BlitNtoNPixelAlpha;
 
@@ -1342,14 +1803,14 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if (features & SDL_CPU_MMX)
                             return Blit565to565SurfaceAlphaMMX;
                         else
 #endif
                             return Blit565to565SurfaceAlpha;
                     } else if (df->Gmask == 0x3e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX())
+                        if (features & SDL_CPU_MMX)
                             return Blit555to555SurfaceAlphaMMX;
                         else
 #endif
@@ -1362,10 +1823,24 @@ SDL_CalculateBlitA(SDL_Surface * surface)
                 if (sf->Rmask == df->Rmask
                     && sf->Gmask == df->Gmask
                     && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
+                    if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+#if HAVE_AVX2_INTRINSICS
+                        if (features & SDL_CPU_AVX2)
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                        if (features & SDL_CPU_SSE41)
+                            return BlitRGBtoRGBSurfaceAlphaSSE41;
+#endif
+#if HAVE_NEON_INTRINSICS
+                        if (features & SDL_CPU_NEON)
+                            return BlitRGBtoRGBSurfaceAlphaNEON;
+#endif
+                    }
 #ifdef __MMX__
                     if (sf->Rshift % 8 == 0
                         && sf->Gshift % 8 == 0
-                        && sf->Bshift % 8 == 0 && SDL_HasMMX())
+                        && sf->Bshift % 8 == 0 && (features & SDL_CPU_MMX))
                         return BlitRGBtoRGBSurfaceAlphaMMX;
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
@@ -3136,6 +3136,288 @@ Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo * info)
     return;
 }
 
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+/* Byte shuffle blitters for 24 and 32 bpp formats with 8 bits per channel.
+   One table lookup handles four pixels of any RGB(A) ordering, including
+   24 <-> 32 bpp expansion and packing.  The shuffle index for a byte that
+   should be cleared is out of range, which is zero for pshufb and vtbl.
+   The padding byte of 32 bpp formats without alpha is cleared or kept the
+   same way the C blitters would, so the result doesn't depend on the CPU.
+*/
+#define SWIZZLE_ZERO    0x80
+
+static int
+SwizzleOffset(const SDL_PixelFormat * fmt, Uint8 shift)
+{
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return shift / 8;
+#else
+    return fmt->BytesPerPixel - 1 - shift / 8;
+#endif
+}
+
+/* Whether the C blitter for this conversion leaves the destination padding
+   alone: Blit_3or4_to_3or4__same_rgb and __inversed_rgb do, BlitNtoN clears it */
+static SDL_bool
+SwizzleKeepsPadding(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt)
+{
+    const SDL_PixelFormat *fmts[2];
+    int i;
+
+    if (!HAVE_FAST_WRITE_INT8 || dstfmt->BytesPerPixel != 4 || dstfmt->Amask) {
+        return SDL_FALSE;
+    }
+    fmts[0] = srcfmt;
+    fmts[1] = dstfmt;
+    for (i = 0; i < 2; ++i) {
+        const SDL_PixelFormat *fmt = fmts[i];
+        if (fmt->Gmask != 0x0000FF00 ||
+            !((fmt->Rmask == 0x000000FF && fmt->Bmask == 0x00FF0000) ||
+              (fmt->Rmask == 0x00FF0000 && fmt->Bmask == 0x000000FF))) {
+            return SDL_FALSE;
+        }
+    }
+    /* 24 bpp sources, and 32 bpp sources with red and blue swapped */
+    return (srcfmt->BytesPerPixel == 3 || srcfmt->Rmask != dstfmt->Rmask) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* The shuffle for four pixels, the alpha bytes to set afterwards and the
+   destination bytes to keep. Returns SDL_TRUE if any bytes are kept. */
+static SDL_bool
+GetSwizzle(const SDL_BlitInfo * info, Uint8 shuffle[16], Uint8 alpha[16], Uint8 keep[16])
+{
+    const SDL_PixelFormat *srcfmt = info->src_fmt;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+    int srcbpp = srcfmt->BytesPerPixel;
+    int dstbpp = dstfmt->BytesPerPixel;
+    SDL_bool keep_padding = SwizzleKeepsPadding(srcfmt, dstfmt);
+    int i;
+
+    SDL_memset(shuffle, SWIZZLE_ZERO, 16);
+    SDL_memset(alpha, 0, 16);
+    SDL_memset(keep, 0, 16);
+    for (i = 0; i < 4; ++i) {
+        Uint8 *d = &shuffle[i * dstbpp];
+        int s = i * srcbpp;
+
+        d[SwizzleOffset(dstfmt, dstfmt->Rshift)] = s + SwizzleOffset(srcfmt, srcfmt->Rshift);
+        d[SwizzleOffset(dstfmt, dstfmt->Gshift)] = s + SwizzleOffset(srcfmt, srcfmt->Gshift);
+        d[SwizzleOffset(dstfmt, dstfmt->Bshift)] = s + SwizzleOffset(srcfmt, srcfmt->Bshift);
+        if (dstfmt->Amask) {
+            if (srcfmt->Amask) {
+                d[SwizzleOffset(dstfmt, dstfmt->Ashift)] = s + SwizzleOffset(srcfmt, srcfmt->Ashift);
+            } else {
+                alpha[i * dstbpp + SwizzleOffset(dstfmt, dstfmt->Ashift)] = info->a;
+            }
+        } else if (keep_padding) {
+            int j;
+            for (j = 0; j < 4; ++j) {
+                if (d[j] == SWIZZLE_ZERO) {
+                    keep[i * dstbpp + j] = 0xFF;
+                }
+            }
+        }
+    }
+    return keep_padding;
+}
+
+/* Leftover pixels at the end of a row, using the shuffle for the first pixel */
+static void
+BlitSwizzleRemainder(const Uint8 * src, Uint8 * dst, int n, int srcbpp, int dstbpp,
+                     const Uint8 shuffle[16], const Uint8 alpha[16], const Uint8 keep[16])
+{
+    int i;
+
+    while (n--) {
+        for (i = 0; i < dstbpp; ++i) {
+            dst[i] = (shuffle[i] == SWIZZLE_ZERO ? 0 : src[shuffle[i]]) | alpha[i] | (dst[i] & keep[i]);
+        }
+        src += srcbpp;
+        dst += dstbpp;
+    }
+}
+
+/* Whether the swizzle blitters handle this conversion */
+static SDL_bool
+CanSwizzle(const SDL_PixelFormat * srcfmt, const SDL_PixelFormat * dstfmt)
+{
+    const SDL_PixelFormat *fmts[2];
+    int i;
+
+    fmts[0] = srcfmt;
+    fmts[1] = dstfmt;
+    for (i = 0; i < 2; ++i) {
+        const SDL_PixelFormat *fmt = fmts[i];
+        if (fmt->BytesPerPixel != 3 && fmt->BytesPerPixel != 4) {
+            return SDL_FALSE;
+        }
+        if (fmt->Rloss || fmt->Gloss || fmt->Bloss ||
+            fmt->Rshift % 8 || fmt->Gshift % 8 || fmt->Bshift % 8) {
+            return SDL_FALSE;
+        }
+        if (fmt->Amask && (fmt->Aloss || fmt->Ashift % 8)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS */
+
+#if HAVE_SSE41_INTRINSICS
+/* pshufb is SSSE3, which every CPU with SSE4.1 has */
+static void SDL_TARGETING("ssse3")
+BlitSwizzleSSSE3(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcbpp = info->src_fmt->BytesPerPixel;
+    int dstbpp = info->dst_fmt->BytesPerPixel;
+    /* 16 byte loads and stores cover six 24 bpp pixels */
+    int minimum = (srcbpp == 3 || dstbpp == 3) ? 6 : 4;
+    Uint8 shuffle[16], alpha[16], keep[16];
+    SDL_bool keep_dst;
+    __m128i vshuffle, valpha, vkeep;
+
+    keep_dst = GetSwizzle(info, shuffle, alpha, keep);
+    vshuffle = _mm_loadu_si128((const __m128i *) shuffle);
+    valpha = _mm_loadu_si128((const __m128i *) alpha);
+    vkeep = _mm_loadu_si128((const __m128i *) keep);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = width;
+
+        while (n >= minimum) {
+            __m128i v = _mm_loadu_si128((const __m128i *) s);
+            v = _mm_or_si128(_mm_shuffle_epi8(v, vshuffle), valpha);
+            if (keep_dst) {
+                v = _mm_or_si128(v, _mm_and_si128(_mm_loadu_si128((const __m128i *) d), vkeep));
+            }
+            _mm_storeu_si128((__m128i *) d, v);
+            s += 4 * srcbpp;
+            d += 4 * dstbpp;
+            n -= 4;
+        }
+        BlitSwizzleRemainder(s, d, n, srcbpp, dstbpp, shuffle, alpha, keep);
+        src += width * srcbpp + info->src_skip;
+        dst += width * dstbpp + info->dst_skip;
+    }
+}
+#endif /* HAVE_SSE41_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+/* Eight pixels at a time, vpshufb shuffles each 128-bit half separately */
+static void SDL_TARGETING("avx2")
+BlitSwizzleAVX2(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcbpp = info->src_fmt->BytesPerPixel;
+    int dstbpp = info->dst_fmt->BytesPerPixel;
+    int minimum = (srcbpp == 3 || dstbpp == 3) ? 10 : 8;
+    Uint8 shuffle[16], alpha[16], keep[16];
+    SDL_bool keep_dst;
+    __m256i vshuffle, valpha, vkeep;
+
+    keep_dst = GetSwizzle(info, shuffle, alpha, keep);
+    vshuffle = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) shuffle));
+    valpha = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) alpha));
+    vkeep = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) keep));
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = width;
+
+        while (n >= minimum) {
+            __m256i v;
+            if (srcbpp == 4) {
+                v = _mm256_loadu_si256((const __m256i *) s);
+            } else {
+                v = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) s));
+                v = _mm256_inserti128_si256(v, _mm_loadu_si128((const __m128i *) (s + 12)), 1);
+            }
+            v = _mm256_or_si256(_mm256_shuffle_epi8(v, vshuffle), valpha);
+            if (dstbpp == 4) {
+                if (keep_dst) {
+                    v = _mm256_or_si256(v, _mm256_and_si256(_mm256_loadu_si256((const __m256i *) d), vkeep));
+                }
+                _mm256_storeu_si256((__m256i *) d, v);
+            } else {
+                _mm_storeu_si128((__m128i *) d, _mm256_castsi256_si128(v));
+                _mm_storeu_si128((__m128i *) (d + 12), _mm256_extracti128_si256(v, 1));
+            }
+            s += 8 * srcbpp;
+            d += 8 * dstbpp;
+            n -= 8;
+        }
+        BlitSwizzleRemainder(s, d, n, srcbpp, dstbpp, shuffle, alpha, keep);
+        src += width * srcbpp + info->src_skip;
+        dst += width * dstbpp + info->dst_skip;
+    }
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static SDL_INLINE uint8x16_t
+SwizzleNEON(uint8x16_t v, uint8x16_t idx)
+{
+#if defined(__aarch64__)
+    return vqtbl1q_u8(v, idx);
+#else
+    uint8x8x2_t table;
+    table.val[0] = vget_low_u8(v);
+    table.val[1] = vget_high_u8(v);
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(idx)), vtbl2_u8(table, vget_high_u8(idx)));
+#endif
+}
+
+static void
+BlitSwizzleNEON(SDL_BlitInfo * info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    Uint8 *dst = info->dst;
+    int srcbpp = info->src_fmt->BytesPerPixel;
+    int dstbpp = info->dst_fmt->BytesPerPixel;
+    int minimum = (srcbpp == 3 || dstbpp == 3) ? 6 : 4;
+    Uint8 shuffle[16], alpha[16], keep[16];
+    SDL_bool keep_dst;
+    uint8x16_t vshuffle, valpha, vkeep;
+
+    keep_dst = GetSwizzle(info, shuffle, alpha, keep);
+    vshuffle = vld1q_u8(shuffle);
+    valpha = vld1q_u8(alpha);
+    vkeep = vld1q_u8(keep);
+
+    while (height--) {
+        const Uint8 *s = src;
+        Uint8 *d = dst;
+        int n = width;
+
+        while (n >= minimum) {
+            uint8x16_t v = vorrq_u8(SwizzleNEON(vld1q_u8(s), vshuffle), valpha);
+            if (keep_dst) {
+                v = vorrq_u8(v, vandq_u8(vld1q_u8(d), vkeep));
+            }
+            vst1q_u8(d, v);
+            s += 4 * srcbpp;
+            d += 4 * dstbpp;
+            n -= 4;
+        }
+        BlitSwizzleRemainder(s, d, n, srcbpp, dstbpp, shuffle, alpha, keep);
+        src += width * srcbpp + info->src_skip;
+        dst += width * dstbpp + info->dst_skip;
+    }
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3280,7 +3562,7 @@ SDL_CalculateBlitN(SDL_Surface * surface)
         return (NULL);
     }
 
-    switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
+    switch (surface->map->info.flags & ~(SDL_COPY_RLE_MASK | SDL_COPY_LINEAR)) {
     case 0:
         blitfun = NULL;
         if (dstfmt->BitsPerPixel == 8) {
@@ -3302,6 +3584,23 @@ SDL_CalculateBlitN(SDL_Surface * surface)
             Uint32 a_need = NO_ALPHA;
             if (dstfmt->Amask)
                 a_need = srcfmt->Amask ? COPY_ALPHA : SET_ALPHA;
+#if HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS
+            if (CanSwizzle(srcfmt, dstfmt)) {
+                const Uint32 features = SDL_GetBlitCPUFeatures();
+#if HAVE_AVX2_INTRINSICS
+                if (features & SDL_CPU_AVX2)
+                    return BlitSwizzleAVX2;
+#endif
+#if HAVE_SSE41_INTRINSICS
+                if (features & SDL_CPU_SSE41)
+                    return BlitSwizzleSSSE3;
+#endif
+#if HAVE_NEON_INTRINSICS
+                if (features & SDL_CPU_NEON)
+                    return BlitSwizzleNEON;
+#endif
+            }
+#endif /* HAVE_SSE41_INTRINSICS || HAVE_AVX2_INTRINSICS || HAVE_NEON_INTRINSICS */
             table = normal_blit[srcfmt->BytesPerPixel - 1];
             for (which = 0; table[which].dstbpp; ++which) {
                 if (MASKOK(srcfmt->Rmask, table[which].srcR) &&
@@ -0,0 +1,286 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_hints.h"
+#include "SDL_thread.h"
+#include "SDL_video.h"
+#include "SDL_blit.h"
+#include "SDL_blit_threads.h"
+
+/* Blits of at least this many pixels are split by default */
+#define SDL_BLIT_DEFAULT_THRESHOLD  (512 * 512)
+
+/* Don't bother splitting work finer than this */
+#define SDL_BLIT_MIN_BAND_ROWS      8
+
+typedef struct
+{
+    SDL_Thread **threads;
+    int num_threads;
+    int num_requested;          /* num_threads may be less if creation failed */
+    SDL_sem *start;
+    SDL_sem *done;
+    SDL_atomic_t quit;
+    SDL_atomic_t next_band;
+
+    SDL_BlitBandFunc func;
+    void *data;
+    int rows;
+    int bands;
+} SDL_BlitThreadPool;
+
+static SDL_SpinLock SDL_blit_lock;
+static SDL_bool SDL_blit_hints_watched = SDL_FALSE;
+static int SDL_blit_threads = 1;
+static int SDL_blit_threshold = SDL_BLIT_DEFAULT_THRESHOLD;
+static SDL_atomic_t SDL_blit_pool_busy;
+static SDL_BlitThreadPool *SDL_blit_pool = NULL;
+static SDL_bool SDL_blit_pool_failed = SDL_FALSE;
+
+static void SDLCALL
+SDL_BlitThreadsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_blit_threads = hint ? SDL_atoi(hint) : 1;
+    SDL_blit_pool_failed = SDL_FALSE;
+}
+
+static void SDLCALL
+SDL_BlitThresholdChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_blit_threshold = (hint && *hint) ? SDL_atoi(hint) : SDL_BLIT_DEFAULT_THRESHOLD;
+}
+
+static void
+SDL_RunBlitBand(SDL_BlitBandFunc func, void *data, int rows, int bands, int band)
+{
+    const int first = (int) (((Sint64) rows * band) / bands);
+    const int last = (int) (((Sint64) rows * (band + 1)) / bands);
+
+    func(data, band, first, last - first);
+}
+
+static void
+SDL_RunPoolBands(SDL_BlitThreadPool *pool)
+{
+    int band;
+
+    while ((band = SDL_AtomicAdd(&pool->next_band, 1)) < pool->bands) {
+        SDL_RunBlitBand(pool->func, pool->data, pool->rows, pool->bands, band);
+    }
+}
+
+static int SDLCALL
+SDL_BlitThread(void *arg)
+{
+    SDL_BlitThreadPool *pool = (SDL_BlitThreadPool *) arg;
+
+    for (;;) {
+        SDL_SemWait(pool->start);
+        if (SDL_AtomicGet(&pool->quit)) {
+            break;
+        }
+        SDL_RunPoolBands(pool);
+        SDL_SemPost(pool->done);
+    }
+    return 0;
+}
+
+static void
+SDL_DestroyBlitThreadPool(SDL_BlitThreadPool *pool)
+{
+    int i;
+
+    SDL_AtomicSet(&pool->quit, 1);
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_SemPost(pool->start);
+    }
+    for (i = 0; i < pool->num_threads; i++) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+    if (pool->start) {
+        SDL_DestroySemaphore(pool->start);
+    }
+    if (pool->done) {
+        SDL_DestroySemaphore(pool->done);
+    }
+    SDL_free(pool->threads);
+    SDL_free(pool);
+}
+
+/* Returns NULL if the threads can't be created */
+static SDL_BlitThreadPool *
+SDL_CreateBlitThreadPool(int num_threads)
+{
+    SDL_BlitThreadPool *pool = (SDL_BlitThreadPool *) SDL_calloc(1, sizeof (*pool));
+
+    if (!pool) {
+        return NULL;
+    }
+    pool->num_requested = num_threads;
+    pool->threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (SDL_Thread *));
+    pool->start = SDL_CreateSemaphore(0);
+    pool->done = SDL_CreateSemaphore(0);
+    if (!pool->threads || !pool->start || !pool->done) {
+        SDL_DestroyBlitThreadPool(pool);
+        return NULL;
+    }
+    while (pool->num_threads < num_threads) {
+        SDL_Thread *thread = SDL_CreateThread(SDL_BlitThread, "SDLBlit", pool);
+        if (!thread) {
+            break;
+        }
+        pool->threads[pool->num_threads++] = thread;
+    }
+    if (pool->num_threads == 0) {
+        SDL_DestroyBlitThreadPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+int
+SDL_GetBlitBands(int rows, int width)
+{
+    int bands;
+
+    if (!SDL_blit_hints_watched) {
+        SDL_AtomicLock(&SDL_blit_lock);
+        if (!SDL_blit_hints_watched) {
+            SDL_AddHintCallback(SDL_HINT_BLIT_THREADS, SDL_BlitThreadsChanged, NULL);
+            SDL_AddHintCallback(SDL_HINT_BLIT_THREAD_THRESHOLD, SDL_BlitThresholdChanged, NULL);
+            SDL_blit_hints_watched = SDL_TRUE;
+        }
+        SDL_AtomicUnlock(&SDL_blit_lock);
+    }
+
+    if (SDL_blit_threads <= 1 || (Sint64) rows * width < SDL_blit_threshold) {
+        return 1;
+    }
+    bands = SDL_min(SDL_blit_threads, rows / SDL_BLIT_MIN_BAND_ROWS);
+    return SDL_max(bands, 1);
+}
+
+void
+SDL_RunBlitBands(SDL_BlitBandFunc func, void *data, int rows, int bands)
+{
+    SDL_BlitThreadPool *pool;
+    int band, i;
+
+    /* Only one blit at a time gets the worker threads */
+    if (bands > 1 && SDL_AtomicCAS(&SDL_blit_pool_busy, 0, 1)) {
+        const int threads = SDL_blit_threads;
+
+        pool = SDL_blit_pool;
+        if (pool && pool->num_requested + 1 != threads) {
+            SDL_DestroyBlitThreadPool(pool);
+            pool = NULL;
+        }
+        /* Don't retry a failed pool on every blit, only after the hint changes */
+        if (!pool && threads > 1 && !SDL_blit_pool_failed) {
+            /* The calling thread runs bands too */
+            pool = SDL_CreateBlitThreadPool(threads - 1);
+            if (!pool) {
+                SDL_blit_pool_failed = SDL_TRUE;
+            }
+        }
+        SDL_blit_pool = pool;
+
+        if (pool) {
+            pool->func = func;
+            pool->data = data;
+            pool->rows = rows;
+            pool->bands = bands;
+            SDL_AtomicSet(&pool->next_band, 0);
+            for (i = 0; i < pool->num_threads; i++) {
+                SDL_SemPost(pool->start);
+            }
+            SDL_RunPoolBands(pool);
+            for (i = 0; i < pool->num_threads; i++) {
+                SDL_SemWait(pool->done);
+            }
+            SDL_AtomicSet(&SDL_blit_pool_busy, 0);
+            return;
+        }
+        SDL_AtomicSet(&SDL_blit_pool_busy, 0);
+    }
+
+    for (band = 0; band < bands; ++band) {
+        SDL_RunBlitBand(func, data, rows, bands, band);
+    }
+}
+
+typedef struct
+{
+    SDL_BlitFunc blit;
+    const SDL_BlitInfo *info;
+} SDL_BlitBands;
+
+static void
+SDL_BlitBand(void *data, int band, int first, int count)
+{
+    const SDL_BlitBands *bands = (const SDL_BlitBands *) data;
+    SDL_BlitInfo info = *bands->info;
+
+    /* Blit functions step through the info, so each band gets a copy */
+    info.src += first * info.src_pitch;
+    info.dst += first * info.dst_pitch;
+    info.src_h = info.dst_h = count;
+    bands->blit(&info);
+}
+
+void
+SDL_RunBlit(SDL_BlitFunc blit, SDL_BlitInfo * info)
+{
+    int bands = 1;
+
+    /* Scaled blits step through the source from their first row, so they can't be split */
+    if (info->src_w == info->dst_w && info->src_h == info->dst_h) {
+        bands = SDL_GetBlitBands(info->dst_h, info->dst_w);
+    }
+    if (bands > 1) {
+        SDL_BlitBands data;
+        data.blit = blit;
+        data.info = info;
+        SDL_RunBlitBands(SDL_BlitBand, &data, info->dst_h, bands);
+    } else {
+        blit(info);
+    }
+}
+
+void
+SDL_QuitBlitThreads(void)
+{
+    if (SDL_blit_pool) {
+        SDL_DestroyBlitThreadPool(SDL_blit_pool);
+        SDL_blit_pool = NULL;
+    }
+    if (SDL_blit_hints_watched) {
+        SDL_DelHintCallback(SDL_HINT_BLIT_THREADS, SDL_BlitThreadsChanged, NULL);
+        SDL_DelHintCallback(SDL_HINT_BLIT_THREAD_THRESHOLD, SDL_BlitThresholdChanged, NULL);
+        SDL_blit_hints_watched = SDL_FALSE;
+    }
+    SDL_blit_threads = 1;
+    SDL_blit_threshold = SDL_BLIT_DEFAULT_THRESHOLD;
+    SDL_blit_pool_failed = SDL_FALSE;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,46 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_blit_threads_h_
+#define SDL_blit_threads_h_
+
+/* Splitting large software blits into bands of rows for worker threads */
+
+/* Draws rows [first, first + count), band is in [0, number of bands) */
+typedef void (*SDL_BlitBandFunc) (void *data, int band, int first, int count);
+
+/* Returns how many bands a blit of rows x width pixels should be split
+   into, following SDL_HINT_BLIT_THREADS and SDL_HINT_BLIT_THREAD_THRESHOLD.
+   1 means the blit should run on the calling thread. */
+extern int SDL_GetBlitBands(int rows, int width);
+
+/* Runs func over every band and returns when they're all done. The bands
+   run one after another if the worker threads are busy with another blit. */
+extern void SDL_RunBlitBands(SDL_BlitBandFunc func, void *data, int rows, int bands);
+
+/* Runs a blit function over info, split with SDL_GetBlitBands() */
+extern void SDL_RunBlit(SDL_BlitFunc blit, SDL_BlitInfo * info);
+
+extern void SDL_QuitBlitThreads(void);
+
+#endif /* SDL_blit_threads_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
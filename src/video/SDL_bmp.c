@@ -38,6 +38,18 @@
 #include "SDL_endian.h"
 #include "SDL_pixels_c.h"
 
+#if defined(__WIN32__) && !defined(__WINRT__)
+#include "../core/windows/SDL_windows.h"
+#define HAVE_BMP_MAPPING
+#elif defined(HAVE_MPROTECT)
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define HAVE_BMP_MAPPING
+#endif
+
 #define SAVE_32BIT_BMP
 
 /* Compression encodings for BMP files */
@@ -54,28 +66,33 @@
 #define LCS_WINDOWS_COLOR_SPACE    0x57696E20
 #endif
 
-static void CorrectAlphaChannel(SDL_Surface *surface)
-{
-    /* Check to see if there is any alpha channel data */
-    SDL_bool hasAlpha = SDL_FALSE;
 #if SDL_BYTEORDER == SDL_BIG_ENDIAN
-    int alphaChannelOffset = 0;
+#define ALPHA_CHANNEL_OFFSET 0
 #else
-    int alphaChannelOffset = 3;
+#define ALPHA_CHANNEL_OFFSET 3
 #endif
-    Uint8 *alpha = ((Uint8*)surface->pixels) + alphaChannelOffset;
-    Uint8 *end = alpha + surface->h * surface->pitch;
+
+/* Check to see if there is any alpha channel data in 32-bit pixels */
+static SDL_bool HasAlphaChannel(const Uint8 *pixels, int size)
+{
+    const Uint8 *alpha = pixels + ALPHA_CHANNEL_OFFSET;
+    const Uint8 *end = pixels + size;
 
     while (alpha < end) {
         if (*alpha != 0) {
-            hasAlpha = SDL_TRUE;
-            break;
+            return SDL_TRUE;
         }
         alpha += 4;
     }
+    return SDL_FALSE;
+}
+
+static void CorrectAlphaChannel(SDL_Surface *surface)
+{
+    Uint8 *alpha = ((Uint8*)surface->pixels) + ALPHA_CHANNEL_OFFSET;
+    Uint8 *end = ((Uint8*)surface->pixels) + surface->h * surface->pitch;
 
-    if (!hasAlpha) {
-        alpha = ((Uint8*)surface->pixels) + alphaChannelOffset;
+    if (!HasAlphaChannel((Uint8*)surface->pixels, surface->h * surface->pitch)) {
         while (alpha < end) {
             *alpha = SDL_ALPHA_OPAQUE;
             alpha += 4;
@@ -83,8 +100,158 @@ static void CorrectAlphaChannel(SDL_Surface *surface)
     }
 }
 
-SDL_Surface *
-SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
+/* A BMP file mapped into memory. The mapping is private, so changes to the
+   pixels of a surface using it are never written back to the file. */
+typedef struct SDL_BMPMapping
+{
+    Uint8 *base;
+    size_t size;
+} SDL_BMPMapping;
+
+static SDL_BMPMapping *SDL_MapBMPFile(const char *file)
+{
+#ifdef HAVE_BMP_MAPPING
+    SDL_BMPMapping *mapping;
+    void *base = NULL;
+    Sint64 size = 0;
+#if defined(__WIN32__)
+    LPTSTR tstr = WIN_UTF8ToString(file);
+    HANDLE handle = CreateFile(tstr, GENERIC_READ, FILE_SHARE_READ, NULL,
+                               OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER filesize;
+
+    SDL_free(tstr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+    if (GetFileSizeEx(handle, &filesize) && filesize.QuadPart > 0 &&
+        filesize.QuadPart <= SDL_MAX_SINT32) {
+        /* The view keeps the file mapping object alive */
+        HANDLE filemapping = CreateFileMapping(handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (filemapping) {
+            base = MapViewOfFile(filemapping, FILE_MAP_COPY, 0, 0, 0);
+            CloseHandle(filemapping);
+        }
+        size = filesize.QuadPart;
+    }
+    CloseHandle(handle);
+#else
+    struct stat st;
+    int fd = open(file, O_RDONLY);
+
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) &&
+        st.st_size > 0 && st.st_size <= SDL_MAX_SINT32) {
+        base = mmap(NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            base = NULL;
+        }
+        size = st.st_size;
+    }
+    close(fd);
+#endif
+    if (!base) {
+        return NULL;
+    }
+
+    mapping = (SDL_BMPMapping *) SDL_malloc(sizeof(*mapping));
+    if (!mapping) {
+#if defined(__WIN32__)
+        UnmapViewOfFile(base);
+#else
+        munmap(base, (size_t) size);
+#endif
+        return NULL;
+    }
+    mapping->base = (Uint8 *) base;
+    mapping->size = (size_t) size;
+    return mapping;
+#else
+    return NULL;
+#endif /* HAVE_BMP_MAPPING */
+}
+
+static void SDL_UnmapBMPFile(SDL_BMPMapping *mapping)
+{
+#ifdef HAVE_BMP_MAPPING
+#if defined(__WIN32__)
+    UnmapViewOfFile(mapping->base);
+#else
+    munmap(mapping->base, mapping->size);
+#endif
+#endif /* HAVE_BMP_MAPPING */
+    SDL_free(mapping);
+}
+
+void SDL_FreeMappedPixels(SDL_Surface *surface)
+{
+    SDL_BMPMapping *mapping = (SDL_BMPMapping *) surface->lock_data;
+
+    SDL_assert(surface->flags & SDL_MAPPED);
+    SDL_UnmapBMPFile(mapping);
+    surface->lock_data = NULL;
+    surface->pixels = NULL;
+}
+
+/* Create a surface using the pixels in the mapping if they are laid out the
+   way SDL needs them, or return NULL to have them read into a new surface. */
+static SDL_Surface *
+CreateMappedSurface(SDL_BMPMapping *mapping, Sint64 offset, int width,
+                    int height, int depth, Uint32 Rmask, Uint32 Gmask,
+                    Uint32 Bmask, Uint32 Amask, SDL_bool correctAlpha)
+{
+    const int bpp = (depth + 7) / 8;
+    SDL_Surface *surface;
+    int pitch;
+
+    switch (depth) {
+    case 8:
+    case 24:
+        break;
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    case 15:
+    case 16:
+    case 32:
+        /* Keep the pixels aligned for the blitters */
+        if ((offset % bpp) != 0) {
+            return NULL;
+        }
+        break;
+#endif
+    default:
+        /* These need to be expanded or byte swapped */
+        return NULL;
+    }
+
+    if (width <= 0 || height <= 0 || width > (SDL_MAX_SINT32 - 3) / bpp) {
+        return NULL;
+    }
+    pitch = (width * bpp + 3) & ~3;
+    if (offset < 0 || offset + (Sint64) pitch * height > (Sint64) mapping->size) {
+        return NULL;
+    }
+
+    /* 32-bit BI_RGB pixels without any alpha data are opaque. Rather than
+       fixing up the alpha channel, which would touch every page of the
+       mapping, leave the alpha channel out of the format. */
+    if (correctAlpha && !HasAlphaChannel(mapping->base + offset, pitch * height)) {
+        Amask = 0;
+    }
+
+    surface = SDL_CreateRGBSurfaceFrom(mapping->base + offset, width, height,
+                                       depth, pitch, Rmask, Gmask, Bmask,
+                                       Amask);
+    if (surface) {
+        surface->flags |= SDL_MAPPED;
+        surface->lock_data = mapping;
+    }
+    return surface;
+}
+
+static SDL_Surface *
+LoadBMP(SDL_RWops * src, int freesrc, SDL_BMPMapping * mapping)
 {
     SDL_bool was_error;
     Sint64 fp_offset = 0;
@@ -298,10 +465,19 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
         goto done;
     }
 
+    /* Use the pixels in place if the file is mapped and stored top-down */
+    if (mapping && topDown && !ExpandBMP) {
+        surface = CreateMappedSurface(mapping, fp_offset + bfOffBits, biWidth,
+                                      biHeight, biBitCount, Rmask, Gmask,
+                                      Bmask, Amask, correctAlpha);
+    }
+
     /* Create a compatible surface, note that the colors are RGB ordered */
-    surface =
-        SDL_CreateRGBSurface(0, biWidth, biHeight, biBitCount, Rmask, Gmask,
-                             Bmask, Amask);
+    if (surface == NULL) {
+        surface =
+            SDL_CreateRGBSurface(0, biWidth, biHeight, biBitCount, Rmask, Gmask,
+                                 Bmask, Amask);
+    }
     if (surface == NULL) {
         was_error = SDL_TRUE;
         goto done;
@@ -358,6 +534,10 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
         }
     }
 
+    if (surface->flags & SDL_MAPPED) {
+        goto done;
+    }
+
     /* Read the surface pixels.  Note that the bmp image is upside down */
     if (SDL_RWseek(src, fp_offset + bfOffBits, RW_SEEK_SET) < 0) {
         SDL_Error(SDL_EFSEEK);
@@ -454,6 +634,11 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
         if (src) {
             SDL_RWseek(src, fp_offset, RW_SEEK_SET);
         }
+        if (surface && (surface->flags & SDL_MAPPED)) {
+            /* The caller still owns the mapping */
+            surface->flags &= ~SDL_MAPPED;
+            surface->lock_data = NULL;
+        }
         SDL_FreeSurface(surface);
         surface = NULL;
     }
@@ -463,6 +648,36 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     return (surface);
 }
 
+SDL_Surface *
+SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
+{
+    return LoadBMP(src, freesrc, NULL);
+}
+
+SDL_Surface *
+SDL_LoadBMP_Mapped(const char *file)
+{
+    SDL_BMPMapping *mapping;
+    SDL_Surface *surface;
+
+    if (!file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+    mapping = SDL_MapBMPFile(file);
+    if (!mapping) {
+        /* The file can't be mapped, read it instead */
+        return SDL_LoadBMP(file);
+    }
+
+    surface = LoadBMP(SDL_RWFromConstMem(mapping->base, (int) mapping->size), 1, mapping);
+    if (!surface || !(surface->flags & SDL_MAPPED)) {
+        SDL_UnmapBMPFile(mapping);
+    }
+    return surface;
+}
+
 int
 SDL_SaveBMP_RW(SDL_Surface * saveme, SDL_RWops * dst, int freedst)
 {
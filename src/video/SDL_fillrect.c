@@ -24,111 +24,143 @@
 #include "SDL_blit.h"
 
 
-#ifdef __SSE__
-/* *INDENT-OFF* */
+/* Fills covering more than this many bytes use non-temporal stores, so
+   clearing a large surface doesn't evict everything else from the cache.
+   Smaller fills are likely to be drawn over or read back soon.
+ */
+#define SDL_FILLRECT_STREAM_BYTES   (1024 * 1024)
 
-#ifdef _MSC_VER
-#define SSE_BEGIN \
-    __m128 c128; \
-    c128.m128_u32[0] = color; \
-    c128.m128_u32[1] = color; \
-    c128.m128_u32[2] = color; \
-    c128.m128_u32[3] = color;
-#else
-#define SSE_BEGIN \
-    __m128 c128; \
-    DECLARE_ALIGNED(Uint32, cccc[4], 16); \
-    cccc[0] = color; \
-    cccc[1] = color; \
-    cccc[2] = color; \
-    cccc[3] = color; \
-    c128 = *(__m128 *)cccc;
-#endif
+/* The SIMD fills write a repeating byte pattern, the color replicated to
+   32 bits or the three bytes of a 24-bit pixel.  Three vectors of the
+   pattern hold a whole number of periods for either one.
+ */
+#define SDL_FILLRECT_MAX_VECTOR     64
+#define SDL_FILLRECT_PATTERN_SIZE   (3 * SDL_FILLRECT_MAX_VECTOR + 4)
+
+static int
+SDL_GetFillPattern(Uint8 *pattern, Uint32 color, int bpp)
+{
+    int i, period;
 
-#define SSE_WORK \
-    for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
-        p += 64; \
+    if (bpp == 3) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        pattern[0] = (Uint8) (color & 0xFF);
+        pattern[1] = (Uint8) ((color >> 8) & 0xFF);
+        pattern[2] = (Uint8) ((color >> 16) & 0xFF);
+#elif SDL_BYTEORDER == SDL_BIG_ENDIAN
+        pattern[0] = (Uint8) ((color >> 16) & 0xFF);
+        pattern[1] = (Uint8) ((color >> 8) & 0xFF);
+        pattern[2] = (Uint8) (color & 0xFF);
+#endif
+        period = 3;
+    } else {
+        SDL_memcpy(pattern, &color, 4);
+        period = 4;
+    }
+    for (i = period; i < SDL_FILLRECT_PATTERN_SIZE; ++i) {
+        pattern[i] = pattern[i - period];
     }
+    return period;
+}
 
-#define SSE_END
+/* *INDENT-OFF* */
 
-#define DEFINE_SSE_FILLRECT(bpp, type) \
-static void \
-SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+/* Each row is filled bytewise up to an aligned address, then three vectors
+   at a time, then bytewise to the end.  'phase' is how far into the
+   pattern the next byte is.
+ */
+#define DEFINE_SIMD_FILLRECT(ISA, TARGET, VTYPE, WIDTH, LOAD, STORE, STREAM, FENCE) \
+static void TARGET \
+SDL_FillRect##ISA(Uint8 *pixels, int pitch, Uint32 color, int bpp, int w, int h) \
 { \
-    int i, n; \
-    Uint8 *p = NULL; \
- \
-    SSE_BEGIN; \
+    Uint8 pattern[SDL_FILLRECT_PATTERN_SIZE]; \
+    const int period = SDL_GetFillPattern(pattern, color, bpp); \
+    const int stream = ((size_t) w * bpp * h >= SDL_FILLRECT_STREAM_BYTES); \
  \
     while (h--) { \
-        n = w * bpp; \
-        p = pixels; \
+        Uint8 *p = pixels; \
+        int n = w * bpp; \
+        int phase = 0; \
  \
-        if (n > 63) { \
-            int adjust = 16 - ((uintptr_t)p & 15); \
-            if (adjust < 16) { \
-                n -= adjust; \
-                adjust /= bpp; \
-                while (adjust--) { \
-                    *((type *)p) = (type)color; \
-                    p += bpp; \
+        if (n >= 4 * WIDTH) { \
+            const int adjust = (int) (-(intptr_t) p & (WIDTH - 1)); \
+            VTYPE v0, v1, v2; \
+ \
+            SDL_memcpy(p, pattern, adjust); \
+            p += adjust; \
+            n -= adjust; \
+            phase = adjust % period; \
+            v0 = LOAD(pattern + phase); \
+            v1 = LOAD(pattern + phase + WIDTH); \
+            v2 = LOAD(pattern + phase + 2 * WIDTH); \
+            if (stream) { \
+                for (; n >= 3 * WIDTH; n -= 3 * WIDTH, p += 3 * WIDTH) { \
+                    STREAM(p, v0); \
+                    STREAM(p + WIDTH, v1); \
+                    STREAM(p + 2 * WIDTH, v2); \
+                } \
+            } else { \
+                for (; n >= 3 * WIDTH; n -= 3 * WIDTH, p += 3 * WIDTH) { \
+                    STORE(p, v0); \
+                    STORE(p + WIDTH, v1); \
+                    STORE(p + 2 * WIDTH, v2); \
                 } \
             } \
-            SSE_WORK; \
-        } \
-        if (n & 63) { \
-            int remainder = (n & 63); \
-            remainder /= bpp; \
-            while (remainder--) { \
-                *((type *)p) = (type)color; \
-                p += bpp; \
+            if (n >= WIDTH) { \
+                STORE(p, v0); \
+                p += WIDTH; \
+                n -= WIDTH; \
+                phase = (phase + WIDTH) % period; \
+                if (n >= WIDTH) { \
+                    STORE(p, v1); \
+                    p += WIDTH; \
+                    n -= WIDTH; \
+                    phase = (phase + WIDTH) % period; \
+                } \
             } \
         } \
+        while (n > 0) { \
+            const int chunk = SDL_min(n, 3 * SDL_FILLRECT_MAX_VECTOR); \
+            SDL_memcpy(p, pattern + phase, chunk); \
+            p += chunk; \
+            n -= chunk; \
+        } \
         pixels += pitch; \
     } \
- \
-    SSE_END; \
+    if (stream) { \
+        FENCE; \
+    } \
 }
 
-static void
-SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
-{
-    int i, n;
+#ifdef __SSE__
+#define SSE_LOAD(p)         _mm_loadu_ps((const float *) (p))
+#define SSE_STORE(p, v)     _mm_store_ps((float *) (p), v)
+#define SSE_STREAM(p, v)    _mm_stream_ps((float *) (p), v)
+DEFINE_SIMD_FILLRECT(SSE, , __m128, 16, SSE_LOAD, SSE_STORE, SSE_STREAM, _mm_sfence())
+#endif
 
-    SSE_BEGIN;
-    while (h--) {
-        Uint8 *p = pixels;
-        n = w;
+#if HAVE_AVX_INTRINSICS
+#define AVX_LOAD(p)         _mm256_loadu_si256((const __m256i *) (p))
+#define AVX_STORE(p, v)     _mm256_store_si256((__m256i *) (p), v)
+#define AVX_STREAM(p, v)    _mm256_stream_si256((__m256i *) (p), v)
+DEFINE_SIMD_FILLRECT(AVX, SDL_TARGETING("avx"), __m256i, 32, AVX_LOAD, AVX_STORE, AVX_STREAM, _mm_sfence())
+#endif
 
-        if (n > 63) {
-            int adjust = 16 - ((uintptr_t)p & 15);
-            if (adjust) {
-                n -= adjust;
-                SDL_memset(p, color, adjust);
-                p += adjust;
-            }
-            SSE_WORK;
-        }
-        if (n & 63) {
-            int remainder = (n & 63);
-            SDL_memset(p, color, remainder);
-        }
-        pixels += pitch;
-    }
+#if HAVE_AVX512F_INTRINSICS
+#define AVX512_LOAD(p)      _mm512_loadu_si512((const void *) (p))
+#define AVX512_STORE(p, v)  _mm512_store_si512((void *) (p), v)
+#define AVX512_STREAM(p, v) _mm512_stream_si512((void *) (p), v)
+DEFINE_SIMD_FILLRECT(AVX512F, SDL_TARGETING("avx512f"), __m512i, 64, AVX512_LOAD, AVX512_STORE, AVX512_STREAM, _mm_sfence())
+#endif
 
-    SSE_END;
-}
-/* DEFINE_SSE_FILLRECT(1, Uint8) */
-DEFINE_SSE_FILLRECT(2, Uint16)
-DEFINE_SSE_FILLRECT(4, Uint32)
+#if HAVE_NEON_INTRINSICS
+/* NEON has no non-temporal stores */
+#define NEON_LOAD(p)        vld1q_u8(p)
+#define NEON_STORE(p, v)    vst1q_u8(p, v)
+DEFINE_SIMD_FILLRECT(NEON, , uint8x16_t, 16, NEON_LOAD, NEON_STORE, NEON_STORE, (void) 0)
+#endif
 
 /* *INDENT-ON* */
-#endif /* __SSE__ */
 
 static void
 SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
@@ -273,70 +305,175 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
 
     switch (dst->format->BytesPerPixel) {
     case 1:
-        {
-            color |= (color << 8);
-            color |= (color << 16);
+        color |= (color << 8);
+        color |= (color << 16);
+        break;
+    case 2:
+        color |= (color << 16);
+        break;
+    }
+
+#if HAVE_AVX512F_INTRINSICS
+    if (SDL_HasAVX512F()) {
+        SDL_FillRectAVX512F(pixels, dst->pitch, color, dst->format->BytesPerPixel, rect->w, rect->h);
+        return 0;
+    }
+#endif
+#if HAVE_AVX_INTRINSICS
+    if (SDL_HasAVX()) {
+        SDL_FillRectAVX(pixels, dst->pitch, color, dst->format->BytesPerPixel, rect->w, rect->h);
+        return 0;
+    }
+#endif
 #ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect1SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
+    if (SDL_HasSSE()) {
+        SDL_FillRectSSE(pixels, dst->pitch, color, dst->format->BytesPerPixel, rect->w, rect->h);
+        return 0;
+    }
 #endif
-            SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_FillRectNEON(pixels, dst->pitch, color, dst->format->BytesPerPixel, rect->w, rect->h);
+        return 0;
+    }
+#endif
+
+    switch (dst->format->BytesPerPixel) {
+    case 1:
+        SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
+        break;
 
     case 2:
-        {
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect2SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+        SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
+        break;
 
     case 3:
-        /* 24-bit RGB is a slow path, at least for now. */
-        {
-            SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+        SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
+        break;
 
     case 4:
-        {
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect4SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
-        }
+        SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
+        break;
     }
 
     /* We're done! */
     return 0;
 }
 
+/* Order rects by row, then along the row */
+static int
+SDL_CompareRectsByRow(const void *a, const void *b)
+{
+    const SDL_Rect *A = (const SDL_Rect *) a;
+    const SDL_Rect *B = (const SDL_Rect *) b;
+
+    if (A->y != B->y) {
+        return (A->y < B->y) ? -1 : 1;
+    }
+    if (A->h != B->h) {
+        return (A->h < B->h) ? -1 : 1;
+    }
+    return (A->x < B->x) ? -1 : (A->x > B->x);
+}
+
+/* Order rects by column, then down the column */
+static int
+SDL_CompareRectsByColumn(const void *a, const void *b)
+{
+    const SDL_Rect *A = (const SDL_Rect *) a;
+    const SDL_Rect *B = (const SDL_Rect *) b;
+
+    if (A->x != B->x) {
+        return (A->x < B->x) ? -1 : 1;
+    }
+    if (A->w != B->w) {
+        return (A->w < B->w) ? -1 : 1;
+    }
+    return (A->y < B->y) ? -1 : (A->y > B->y);
+}
+
+/* Join rects that touch or overlap and span the same rows, or the same
+   columns.  Filling the joined rect touches exactly the same pixels. */
+static int
+SDL_MergeFillRects(SDL_Rect * rects, int count)
+{
+    int i, n;
+
+    SDL_qsort(rects, count, sizeof(*rects), SDL_CompareRectsByRow);
+    for (i = 1, n = 0; i < count; ++i) {
+        SDL_Rect *last = &rects[n];
+        const SDL_Rect *rect = &rects[i];
+        if (rect->y == last->y && rect->h == last->h &&
+            rect->x <= last->x + last->w) {
+            last->w = SDL_max(last->x + last->w, rect->x + rect->w) - last->x;
+        } else {
+            rects[++n] = *rect;
+        }
+    }
+    count = n + 1;
+
+    SDL_qsort(rects, count, sizeof(*rects), SDL_CompareRectsByColumn);
+    for (i = 1, n = 0; i < count; ++i) {
+        SDL_Rect *last = &rects[n];
+        const SDL_Rect *rect = &rects[i];
+        if (rect->x == last->x && rect->w == last->w &&
+            rect->y <= last->y + last->h) {
+            last->h = SDL_max(last->y + last->h, rect->y + rect->h) - last->y;
+        } else {
+            rects[++n] = *rect;
+        }
+    }
+    count = n + 1;
+
+    /* Fill top to bottom */
+    SDL_qsort(rects, count, sizeof(*rects), SDL_CompareRectsByRow);
+    return count;
+}
+
 int
 SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
               Uint32 color)
 {
-    int i;
+    SDL_Rect *clipped;
+    SDL_bool isstack;
+    int i, n;
     int status = 0;
 
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
     if (!rects) {
         return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
 
-    for (i = 0; i < count; ++i) {
-        status += SDL_FillRect(dst, &rects[i], color);
+    clipped = NULL;
+    if (count > 1) {
+        clipped = SDL_small_alloc(SDL_Rect, count, &isstack);
+    }
+    if (!clipped) {
+        for (i = 0; i < count; ++i) {
+            status += SDL_FillRect(dst, &rects[i], color);
+        }
+        return status;
+    }
+
+    if (dst->format->BitsPerPixel < 8) {
+        SDL_small_free(clipped, isstack);
+        return SDL_SetError("SDL_FillRect(): Unsupported surface format");
+    }
+
+    for (i = 0, n = 0; i < count; ++i) {
+        if (SDL_IntersectRect(&rects[i], &dst->clip_rect, &clipped[n])) {
+            ++n;
+        }
+    }
+    if (n > 1) {
+        n = SDL_MergeFillRects(clipped, n);
+    }
+    for (i = 0; i < n; ++i) {
+        status += SDL_FillRect(dst, &clipped[i], color);
     }
+    SDL_small_free(clipped, isstack);
     return status;
 }
 
@@ -635,6 +635,194 @@ SDL_FreeFormat(SDL_PixelFormat *format)
     SDL_free(format);
 }
 
+/* Inverse palettes, for fast nearest color lookups in large palettes.
+
+   The RGB cube is split into cells, and each cell gets the list of palette
+   entries that can be the nearest color of any RGB value in the cell: the
+   entries whose distance to the cell is no more than the smallest distance
+   within which some entry covers the whole cell. The lists are built the
+   first time a cell is looked up, and searching them gives exactly the same
+   result as searching the whole palette.
+
+   SDL_Palette is a public structure that applications can create themselves,
+   so the inverse palettes are kept here instead, keyed by palette and
+   version, and dropped when the palette is freed. Like SDL_ValidateMap(),
+   this relies on the version: code that changes the colors directly
+   instead of calling SDL_SetPaletteColors() must bump palette->version.
+ */
+#define INVERSE_PALETTE_BITS        4
+#define INVERSE_PALETTE_SHIFT       (8 - INVERSE_PALETTE_BITS)
+#define INVERSE_PALETTE_CELLS       (1 << (3 * INVERSE_PALETTE_BITS))
+#define INVERSE_PALETTE_MIN_COLORS  32
+#define INVERSE_PALETTE_CACHE_SIZE  4
+
+typedef struct
+{
+    const SDL_Palette *palette;
+    Uint32 version;
+    int ncolors;
+    SDL_bool usable;            /* the alpha of every color is the same */
+    Uint32 last_used;
+    Uint32 offset[INVERSE_PALETTE_CELLS];
+    Uint16 count[INVERSE_PALETTE_CELLS];    /* 0 until the cell is built */
+    Uint8 *candidates;
+    int num_candidates;
+    int max_candidates;
+} SDL_InversePalette;
+
+static SDL_InversePalette inverse_palettes[INVERSE_PALETTE_CACHE_SIZE];
+static Uint32 inverse_palettes_used = 0;
+static SDL_SpinLock inverse_palettes_lock = 0;
+
+static SDL_InversePalette *
+SDL_GetInversePalette(const SDL_Palette * pal)
+{
+    SDL_InversePalette *inverse = &inverse_palettes[0];
+    int i;
+
+    for (i = 0; i < INVERSE_PALETTE_CACHE_SIZE; ++i) {
+        if (inverse_palettes[i].palette == pal) {
+            inverse = &inverse_palettes[i];
+            break;
+        }
+        if (inverse_palettes[i].last_used < inverse->last_used) {
+            inverse = &inverse_palettes[i];
+        }
+    }
+    inverse->last_used = ++inverse_palettes_used;
+
+    if (inverse->palette != pal || inverse->version != pal->version ||
+        inverse->ncolors != pal->ncolors) {
+        inverse->palette = pal;
+        inverse->version = pal->version;
+        inverse->ncolors = pal->ncolors;
+        inverse->usable = SDL_TRUE;
+        for (i = 1; i < pal->ncolors; ++i) {
+            if (pal->colors[i].a != pal->colors[0].a) {
+                inverse->usable = SDL_FALSE;
+                break;
+            }
+        }
+        SDL_zero(inverse->count);
+        inverse->num_candidates = 0;
+    }
+    return inverse;
+}
+
+/* Adds the squared distances from c to the nearest and farthest values in [lo, lo + size] */
+static void
+SDL_InverseCellDistance(int c, int lo, int size, Uint32 * nearest, Uint32 * farthest)
+{
+    const int outside = SDL_max(lo - c, c - (lo + size));
+    const int edge = SDL_max(c - lo, (lo + size) - c);
+
+    if (outside > 0) {
+        *nearest += outside * outside;
+    }
+    *farthest += edge * edge;
+}
+
+static SDL_bool
+SDL_BuildInverseCell(SDL_InversePalette * inverse, const SDL_Palette * pal, int cell)
+{
+    Uint32 mindist[256];
+    Uint32 bound = ~0u;
+    const int r0 = ((cell >> (2 * INVERSE_PALETTE_BITS)) << INVERSE_PALETTE_SHIFT);
+    const int g0 = (((cell >> INVERSE_PALETTE_BITS) & ((1 << INVERSE_PALETTE_BITS) - 1)) << INVERSE_PALETTE_SHIFT);
+    const int b0 = ((cell & ((1 << INVERSE_PALETTE_BITS) - 1)) << INVERSE_PALETTE_SHIFT);
+    const int size = (1 << INVERSE_PALETTE_SHIFT) - 1;
+    int i;
+
+    if (inverse->num_candidates + pal->ncolors > inverse->max_candidates) {
+        int max_candidates = inverse->num_candidates + pal->ncolors + 1024;
+        Uint8 *candidates = (Uint8 *) SDL_realloc(inverse->candidates, max_candidates);
+        if (!candidates) {
+            return SDL_FALSE;
+        }
+        inverse->candidates = candidates;
+        inverse->max_candidates = max_candidates;
+    }
+
+    for (i = 0; i < pal->ncolors; ++i) {
+        Uint32 nearest = 0, farthest = 0;
+
+        SDL_InverseCellDistance(pal->colors[i].r, r0, size, &nearest, &farthest);
+        SDL_InverseCellDistance(pal->colors[i].g, g0, size, &nearest, &farthest);
+        SDL_InverseCellDistance(pal->colors[i].b, b0, size, &nearest, &farthest);
+        mindist[i] = nearest;
+        if (farthest < bound) {
+            bound = farthest;
+        }
+    }
+
+    inverse->offset[cell] = inverse->num_candidates;
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (mindist[i] <= bound) {
+            inverse->candidates[inverse->num_candidates++] = (Uint8) i;
+        }
+    }
+    inverse->count[cell] = (Uint16) (inverse->num_candidates - inverse->offset[cell]);
+    return SDL_TRUE;
+}
+
+/* Returns the nearest palette index, or -1 if the whole palette should be searched */
+static int
+SDL_FindInverseColor(const SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b)
+{
+    SDL_InversePalette *inverse = SDL_GetInversePalette(pal);
+    const int cell = (((r >> INVERSE_PALETTE_SHIFT) << (2 * INVERSE_PALETTE_BITS)) |
+                      ((g >> INVERSE_PALETTE_SHIFT) << INVERSE_PALETTE_BITS) |
+                      (b >> INVERSE_PALETTE_SHIFT));
+    unsigned int smallest = ~0u;
+    const Uint8 *candidates;
+    int i, count, pixel = 0;
+
+    if (!inverse->usable) {
+        return -1;
+    }
+    if (!inverse->count[cell] && !SDL_BuildInverseCell(inverse, pal, cell)) {
+        return -1;
+    }
+
+    /* The alpha distance is the same for every color, so leave it out */
+    candidates = &inverse->candidates[inverse->offset[cell]];
+    count = inverse->count[cell];
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *color = &pal->colors[candidates[i]];
+        const int rd = color->r - r;
+        const int gd = color->g - g;
+        const int bd = color->b - b;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd);
+        if (distance < smallest) {
+            pixel = candidates[i];
+            if (distance == 0) {
+                break;
+            }
+            smallest = distance;
+        }
+    }
+    return pixel;
+}
+
+static void
+SDL_DropInversePalette(const SDL_Palette * pal)
+{
+    int i;
+
+    SDL_AtomicLock(&inverse_palettes_lock);
+    for (i = 0; i < INVERSE_PALETTE_CACHE_SIZE; ++i) {
+        if (inverse_palettes[i].palette == pal) {
+            inverse_palettes[i].palette = NULL;
+            inverse_palettes[i].last_used = 0;
+            SDL_free(inverse_palettes[i].candidates);
+            inverse_palettes[i].candidates = NULL;
+            inverse_palettes[i].num_candidates = 0;
+            inverse_palettes[i].max_candidates = 0;
+        }
+    }
+    SDL_AtomicUnlock(&inverse_palettes_lock);
+}
+
 SDL_Palette *
 SDL_AllocPalette(int ncolors)
 {
@@ -731,6 +919,7 @@ SDL_FreePalette(SDL_Palette * palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_DropInversePalette(palette);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -776,6 +965,15 @@ SDL_FindColor(SDL_Palette * pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     int i;
     Uint8 pixel = 0;
 
+    if (pal->ncolors >= INVERSE_PALETTE_MIN_COLORS && pal->ncolors <= 256) {
+        SDL_AtomicLock(&inverse_palettes_lock);
+        i = SDL_FindInverseColor(pal, r, g, b);
+        SDL_AtomicUnlock(&inverse_palettes_lock);
+        if (i >= 0) {
+            return (Uint8) i;
+        }
+    }
+
     smallest = ~0;
     for (i = 0; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
@@ -968,12 +1166,10 @@ SDL_AllocBlitMap(void)
     return (map);
 }
 
-void
-SDL_InvalidateMap(SDL_BlitMap * map)
+/* Drop the mapping to the current destination, leaving the cache alone */
+static void
+SDL_ReleaseMapping(SDL_BlitMap * map)
 {
-    if (!map) {
-        return;
-    }
     if (map->dst) {
         /* Release our reference to the surface - see the note below */
         if (--map->dst->refcount <= 0) {
@@ -987,6 +1183,121 @@ SDL_InvalidateMap(SDL_BlitMap * map)
     map->info.table = NULL;
 }
 
+void
+SDL_InvalidateMap(SDL_BlitMap * map)
+{
+    int i;
+
+    if (!map) {
+        return;
+    }
+
+    /* The surface settings changed, so none of the cached mappings apply */
+    for (i = 0; i < map->num_cached; ++i) {
+        SDL_FreeFormat(map->cache[i].dst_fmt);
+        SDL_free(map->cache[i].table);
+    }
+    map->num_cached = 0;
+
+    SDL_ReleaseMapping(map);
+}
+
+/* Move the current mapping to the front of the cache */
+static void
+SDL_CacheMapping(SDL_BlitMap * map)
+{
+    SDL_BlitMapCache *entry;
+
+    if (!map->dst || (map->info.flags & SDL_COPY_RLE_MASK)) {
+        /* RLE data is encoded for one destination and can't be kept */
+        SDL_ReleaseMapping(map);
+        return;
+    }
+
+    if (map->num_cached == SDL_BLITMAP_CACHE_SIZE) {
+        --map->num_cached;
+        SDL_FreeFormat(map->cache[map->num_cached].dst_fmt);
+        SDL_free(map->cache[map->num_cached].table);
+    }
+    SDL_memmove(&map->cache[1], &map->cache[0],
+                map->num_cached * sizeof(map->cache[0]));
+    ++map->num_cached;
+
+    entry = &map->cache[0];
+    entry->dst_fmt = map->dst->format;
+    SDL_AtomicLock(&formats_lock);
+    ++entry->dst_fmt->refcount;
+    SDL_AtomicUnlock(&formats_lock);
+    entry->dst_palette = entry->dst_fmt->palette;
+    entry->dst_palette_version = map->dst_palette_version;
+    entry->src_palette_version = map->src_palette_version;
+    entry->cpu_features = map->cpu_features;
+    entry->flags = map->info.flags;
+    entry->r = map->info.r;
+    entry->g = map->info.g;
+    entry->b = map->info.b;
+    entry->a = map->info.a;
+    entry->identity = map->identity;
+    entry->blit = map->blit;
+    entry->data = map->data;
+    entry->table = map->info.table;
+
+    /* The table belongs to the cache entry now */
+    map->info.table = NULL;
+    SDL_ReleaseMapping(map);
+}
+
+/* Switch to a cached mapping for this destination, if there is one */
+static SDL_bool
+SDL_UseCachedMapping(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_PixelFormat *dstfmt = dst->format;
+    Uint32 dst_palette_version = dstfmt->palette ? dstfmt->palette->version : 0;
+    Uint32 src_palette_version = src->format->palette ? src->format->palette->version : 0;
+    Uint32 cpu_features = SDL_GetBlitCPUFeatures();
+    SDL_BlitMapCache *entry = NULL;
+    int i;
+
+    for (i = 0; i < map->num_cached; ++i) {
+        entry = &map->cache[i];
+        if (entry->dst_fmt == dstfmt &&
+            entry->dst_palette == dstfmt->palette &&
+            entry->dst_palette_version == dst_palette_version &&
+            entry->src_palette_version == src_palette_version &&
+            entry->cpu_features == cpu_features &&
+            entry->flags == map->info.flags &&
+            entry->r == map->info.r && entry->g == map->info.g &&
+            entry->b == map->info.b && entry->a == map->info.a) {
+            break;
+        }
+    }
+    if (!entry || i == map->num_cached) {
+        return SDL_FALSE;
+    }
+
+    map->identity = entry->identity;
+    map->blit = entry->blit;
+    map->data = entry->data;
+    map->info.table = entry->table;
+    map->info.src_fmt = src->format;
+    map->info.src_pitch = src->pitch;
+    map->info.dst_fmt = dstfmt;
+    map->info.dst_pitch = dst->pitch;
+    map->dst = dst;
+    ++dst->refcount;
+    map->dst_palette_version = dst_palette_version;
+    map->src_palette_version = src_palette_version;
+    map->cpu_features = cpu_features;
+
+    /* The map's reference to the surface keeps the format alive */
+    SDL_FreeFormat(entry->dst_fmt);
+    --map->num_cached;
+    SDL_memmove(&map->cache[i], &map->cache[i + 1],
+                (map->num_cached - i) * sizeof(map->cache[0]));
+    return SDL_TRUE;
+}
+
 int
 SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
 {
@@ -994,12 +1305,16 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
 
-    /* Clear out any previous mapping */
+    /* Set aside any previous mapping, we may want it back later */
     map = src->map;
     if ((src->flags & SDL_RLEACCEL) == SDL_RLEACCEL) {
         SDL_UnRLESurface(src, 1);
     }
-    SDL_InvalidateMap(map);
+    SDL_CacheMapping(map);
+
+    if (SDL_UseCachedMapping(src, dst)) {
+        return 0;
+    }
 
     /* Figure out what kind of mapping we're doing */
     map->identity = 0;
@@ -1070,6 +1385,7 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     }
 
     /* Choose your blitters wisely */
+    map->cpu_features = SDL_GetBlitCPUFeatures();
     return (SDL_CalculateBlit(src));
 }
 
@@ -0,0 +1,442 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Rectangle sets in y-x banded form, see SDL_region_c.h
+
+   A union walks both regions from top to bottom, one horizontal band at a
+   time, and merges the spans of the two bands with a sweep from left to
+   right.
+*/
+
+#include "SDL_region_c.h"
+
+void
+SDL_InitRegion(SDL_Region * region)
+{
+    SDL_zerop(region);
+}
+
+void
+SDL_FreeRegion(SDL_Region * region)
+{
+    SDL_free(region->rects);
+    SDL_free(region->scratch);
+    SDL_zerop(region);
+}
+
+static SDL_bool
+SDL_AddRegionRect(SDL_Region * region, int x, int y, int w, int h)
+{
+    SDL_Rect *rect;
+
+    if (region->numrects == region->maxrects) {
+        const int maxrects = SDL_max(2 * region->maxrects, 16);
+        SDL_Rect *rects = (SDL_Rect *) SDL_realloc(region->rects, maxrects * sizeof(*rects));
+        if (!rects) {
+            return SDL_FALSE;
+        }
+        region->rects = rects;
+        region->maxrects = maxrects;
+    }
+    rect = &region->rects[region->numrects++];
+    rect->x = x;
+    rect->y = y;
+    rect->w = w;
+    rect->h = h;
+    return SDL_TRUE;
+}
+
+/* Returns the number of rectangles in the band starting at rects[first] */
+static int
+SDL_GetBandSize(const SDL_Rect * rects, int numrects, int first)
+{
+    int i = first + 1;
+
+    while (i < numrects && rects[i].y == rects[first].y) {
+        ++i;
+    }
+    return i - first;
+}
+
+/* Extends the band at rects[prev] down over the following band at
+   rects[next], if they touch and have the same spans */
+static SDL_bool
+SDL_CoalesceBands(SDL_Rect * rects, int prev, int next, int count)
+{
+    int i;
+
+    if (prev < 0 || next - prev != count ||
+        rects[prev].y + rects[prev].h != rects[next].y) {
+        return SDL_FALSE;
+    }
+    for (i = 0; i < count; ++i) {
+        if (rects[prev + i].x != rects[next + i].x ||
+            rects[prev + i].w != rects[next + i].w) {
+            return SDL_FALSE;
+        }
+    }
+    for (i = 0; i < count; ++i) {
+        rects[prev + i].h += rects[next].h;
+    }
+    return SDL_TRUE;
+}
+
+/* Merges the bands of a region that can be merged, after it was changed in place */
+static void
+SDL_CoalesceRegion(SDL_Region * region)
+{
+    SDL_Rect *rects = region->rects;
+    int i = 0, numrects = 0, prev = -1;
+
+    while (i < region->numrects) {
+        const int count = SDL_GetBandSize(rects, region->numrects, i);
+
+        if (numrects != i) {
+            SDL_memmove(&rects[numrects], &rects[i], count * sizeof(*rects));
+        }
+        if (!SDL_CoalesceBands(rects, prev, numrects, count)) {
+            prev = numrects;
+            numrects += count;
+        }
+        i += count;
+    }
+    region->numrects = numrects;
+}
+
+/* Edge e of a band, the even edges are left sides and the odd are right sides */
+#define SPAN_EDGE(spans, e) \
+    (((e) & 1) ? (spans)[(e) >> 1].x + (spans)[(e) >> 1].w : (spans)[(e) >> 1].x)
+
+/* Adds the union of the spans a and b as band [y, y + h) */
+static SDL_bool
+SDL_CombineSpans(SDL_Region * result, int y, int h,
+                 const SDL_Rect * a, int numa, const SDL_Rect * b, int numb)
+{
+    SDL_bool inA = SDL_FALSE, inB = SDL_FALSE, inside = SDL_FALSE;
+    int ea = 0, eb = 0, start = 0;
+
+    numa *= 2;
+    numb *= 2;
+    while (ea < numa || eb < numb) {
+        const int xa = (ea < numa) ? SPAN_EDGE(a, ea) : SDL_MAX_SINT32;
+        const int xb = (eb < numb) ? SPAN_EDGE(b, eb) : SDL_MAX_SINT32;
+        const int x = SDL_min(xa, xb);
+        SDL_bool now;
+
+        if (xa == x) {
+            inA = (ea & 1) ? SDL_FALSE : SDL_TRUE;
+            ++ea;
+        }
+        if (xb == x) {
+            inB = (eb & 1) ? SDL_FALSE : SDL_TRUE;
+            ++eb;
+        }
+        now = (inA || inB);
+        if (now && !inside) {
+            start = x;
+        } else if (!now && inside) {
+            if (!SDL_AddRegionRect(result, start, y, x - start, h)) {
+                return SDL_FALSE;
+            }
+        }
+        inside = now;
+    }
+    return SDL_TRUE;
+}
+
+int
+SDL_UnionRegion(SDL_Region * result, const SDL_Region * A, const SDL_Region * B)
+{
+    SDL_Region out;
+    int ia = 0, ib = 0, sizea = 0, sizeb = 0;
+    int prev = -1;
+    int y = SDL_MIN_SINT32;
+
+    SDL_InitRegion(&out);
+
+    for (;;) {
+        int topa, topb, y1, first;
+        SDL_bool inA, inB;
+
+        /* Move past the bands that end above y */
+        while (ia < A->numrects && A->rects[ia].y + A->rects[ia].h <= y) {
+            ia += SDL_GetBandSize(A->rects, A->numrects, ia);
+        }
+        while (ib < B->numrects && B->rects[ib].y + B->rects[ib].h <= y) {
+            ib += SDL_GetBandSize(B->rects, B->numrects, ib);
+        }
+        if (ia == A->numrects && ib == B->numrects) {
+            break;
+        }
+
+        topa = (ia < A->numrects) ? A->rects[ia].y : SDL_MAX_SINT32;
+        topb = (ib < B->numrects) ? B->rects[ib].y : SDL_MAX_SINT32;
+        if (topa > y && topb > y) {
+            y = SDL_min(topa, topb);
+            continue;
+        }
+        inA = (topa <= y);
+        inB = (topb <= y);
+        sizea = inA ? SDL_GetBandSize(A->rects, A->numrects, ia) : 0;
+        sizeb = inB ? SDL_GetBandSize(B->rects, B->numrects, ib) : 0;
+        y1 = SDL_min(inA ? topa + A->rects[ia].h : topa,
+                     inB ? topb + B->rects[ib].h : topb);
+
+        first = out.numrects;
+        if (!SDL_CombineSpans(&out, y, y1 - y,
+                              inA ? &A->rects[ia] : NULL, sizea,
+                              inB ? &B->rects[ib] : NULL, sizeb)) {
+            SDL_FreeRegion(&out);
+            return SDL_OutOfMemory();
+        }
+        if (out.numrects > first) {
+            if (SDL_CoalesceBands(out.rects, prev, first, out.numrects - first)) {
+                out.numrects = first;
+            } else {
+                prev = first;
+            }
+        }
+        y = y1;
+    }
+
+    /* The result keeps its own scratch space */
+    SDL_free(result->rects);
+    result->rects = out.rects;
+    result->numrects = out.numrects;
+    result->maxrects = out.maxrects;
+    return 0;
+}
+
+static int SDLCALL
+SDL_CompareInts(const void *a, const void *b)
+{
+    const int A = *(const int *) a;
+    const int B = *(const int *) b;
+
+    return (A < B) ? -1 : (A > B);
+}
+
+static int SDLCALL
+SDL_CompareRectsByX(const void *a, const void *b)
+{
+    return SDL_CompareInts(&((const SDL_Rect *) a)->x, &((const SDL_Rect *) b)->x);
+}
+
+int
+SDL_SetRegionRects(SDL_Region * region, const SDL_Rect * rects, int numrects)
+{
+    int *edges;
+    SDL_Rect *spans;
+    int numedges = 0;
+    int prev = -1;
+    int i, j;
+
+    region->numrects = 0;
+    if (numrects <= 0) {
+        return 0;
+    }
+
+    /* The edges and spans are kept with the region, so steady updates don't allocate */
+    if (numrects > region->maxscratch) {
+        int *scratch = (int *) SDL_realloc(region->scratch, numrects * (2 * sizeof(*edges) + sizeof(*spans)));
+        if (!scratch) {
+            return SDL_OutOfMemory();
+        }
+        region->scratch = scratch;
+        region->maxscratch = numrects;
+    }
+    edges = region->scratch;
+    spans = (SDL_Rect *) &edges[2 * numrects];
+
+    /* Every top and bottom edge starts a new band */
+    for (i = 0; i < numrects; ++i) {
+        if (!SDL_RectEmpty(&rects[i])) {
+            edges[numedges++] = rects[i].y;
+            edges[numedges++] = rects[i].y + rects[i].h;
+        }
+    }
+    SDL_qsort(edges, numedges, sizeof(*edges), SDL_CompareInts);
+
+    for (i = 0; i + 1 < numedges; ++i) {
+        const int y = edges[i];
+        const int h = edges[i + 1] - y;
+        int numspans = 0, first;
+
+        if (h == 0) {
+            continue;
+        }
+
+        /* Sort the rectangles covering the band, and merge the ones that overlap or touch */
+        for (j = 0; j < numrects; ++j) {
+            if (!SDL_RectEmpty(&rects[j]) && rects[j].y <= y && rects[j].y + rects[j].h > y) {
+                spans[numspans++] = rects[j];
+            }
+        }
+        if (numspans == 0) {
+            continue;
+        }
+        SDL_qsort(spans, numspans, sizeof(*spans), SDL_CompareRectsByX);
+
+        first = region->numrects;
+        for (j = 0; j < numspans; ) {
+            const int x = spans[j].x;
+            int x1 = x + spans[j].w;
+
+            for (++j; j < numspans && spans[j].x <= x1; ++j) {
+                x1 = SDL_max(x1, spans[j].x + spans[j].w);
+            }
+            if (!SDL_AddRegionRect(region, x, y, x1 - x, h)) {
+                region->numrects = 0;
+                return SDL_OutOfMemory();
+            }
+        }
+        if (SDL_CoalesceBands(region->rects, prev, first, region->numrects - first)) {
+            region->numrects = first;
+        } else {
+            prev = first;
+        }
+    }
+    return 0;
+}
+
+void
+SDL_IntersectRegionRect(SDL_Region * region, const SDL_Rect * rect)
+{
+    int i, numrects = 0;
+
+    /* Clipping keeps the bands in order, it can only make some of them match */
+    for (i = 0; i < region->numrects; ++i) {
+        SDL_Rect clipped;
+        if (SDL_IntersectRect(&region->rects[i], rect, &clipped)) {
+            region->rects[numrects++] = clipped;
+        }
+    }
+    region->numrects = numrects;
+    SDL_CoalesceRegion(region);
+}
+
+/* Finds the cheapest way to take one step towards fewer rectangles:
+   closing the gap between two spans of a band, or stretching two adjacent
+   bands into one that covers both of them. The cost is the area added. */
+static SDL_bool
+SDL_FindRegionMerge(const SDL_Region * region, SDL_Region * scratch,
+                    int *merge_first, SDL_bool *merge_bands)
+{
+    const SDL_Rect *rects = region->rects;
+    Sint64 best = -1;
+    int i, j;
+
+    for (i = 0; i < region->numrects; ) {
+        const int count = SDL_GetBandSize(rects, region->numrects, i);
+        const int next = i + count;
+
+        for (j = i; j + 1 < next; ++j) {
+            const Sint64 gap = rects[j + 1].x - (rects[j].x + rects[j].w);
+            const Sint64 cost = gap * rects[j].h;
+            if (best < 0 || cost < best) {
+                best = cost;
+                *merge_first = j;
+                *merge_bands = SDL_FALSE;
+            }
+        }
+
+        if (next < region->numrects) {
+            const int nextcount = SDL_GetBandSize(rects, region->numrects, next);
+            const int h = rects[next].y + rects[next].h - rects[i].y;
+            Sint64 area = 0, cost;
+
+            scratch->numrects = 0;
+            if (!SDL_CombineSpans(scratch, rects[i].y, h,
+                                  &rects[i], count, &rects[next], nextcount)) {
+                return SDL_FALSE;
+            }
+            for (j = 0; j < scratch->numrects; ++j) {
+                area += (Sint64) scratch->rects[j].w * h;
+            }
+            for (j = i; j < next + nextcount; ++j) {
+                area -= (Sint64) rects[j].w * rects[j].h;
+            }
+            cost = area;
+            if (best < 0 || cost < best) {
+                best = cost;
+                *merge_first = i;
+                *merge_bands = SDL_TRUE;
+            }
+        }
+        i = next;
+    }
+    return SDL_TRUE;
+}
+
+int
+SDL_SimplifyRegion(SDL_Region * region, int maxrects)
+{
+    SDL_Region scratch;
+
+    if (region->numrects <= maxrects) {
+        return 0;
+    }
+    if (maxrects < 1) {
+        return SDL_InvalidParamError("maxrects");
+    }
+
+    /* Every step removes a rectangle or a band, and never adds one */
+    SDL_InitRegion(&scratch);
+    while (region->numrects > maxrects) {
+        SDL_Rect *rects = region->rects;
+        int first = 0;
+        SDL_bool merge_bands = SDL_FALSE;
+
+        if (!SDL_FindRegionMerge(region, &scratch, &first, &merge_bands)) {
+            SDL_FreeRegion(&scratch);
+            return SDL_OutOfMemory();
+        }
+
+        if (merge_bands) {
+            const int count = SDL_GetBandSize(rects, region->numrects, first);
+            const int next = first + count;
+            const int nextcount = SDL_GetBandSize(rects, region->numrects, next);
+            const int h = rects[next].y + rects[next].h - rects[first].y;
+
+            scratch.numrects = 0;
+            if (!SDL_CombineSpans(&scratch, rects[first].y, h,
+                                  &rects[first], count, &rects[next], nextcount)) {
+                SDL_FreeRegion(&scratch);
+                return SDL_OutOfMemory();
+            }
+            SDL_memcpy(&rects[first], scratch.rects, scratch.numrects * sizeof(*rects));
+            SDL_memmove(&rects[first + scratch.numrects], &rects[next + nextcount],
+                        (region->numrects - (next + nextcount)) * sizeof(*rects));
+            region->numrects -= (count + nextcount - scratch.numrects);
+        } else {
+            rects[first].w = rects[first + 1].x + rects[first + 1].w - rects[first].x;
+            SDL_memmove(&rects[first + 1], &rects[first + 2],
+                        (region->numrects - (first + 2)) * sizeof(*rects));
+            --region->numrects;
+        }
+        SDL_CoalesceRegion(region);
+    }
+    SDL_FreeRegion(&scratch);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
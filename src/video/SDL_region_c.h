@@ -0,0 +1,63 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_region_c_h_
+#define SDL_region_c_h_
+
+#include "../SDL_internal.h"
+
+#include "SDL_rect.h"
+
+/* A set of pixels, stored as disjoint rectangles in y-x banded order:
+   the rectangles are sorted by y and then by x, rectangles with the same
+   y also have the same height, and rectangles in a band never touch.
+   Vertically adjacent bands with the same spans are merged, so a region
+   has only one representation.
+
+   A zeroed SDL_Region is an empty region. */
+typedef struct SDL_Region
+{
+    SDL_Rect *rects;
+    int numrects;
+    int maxrects;
+    int *scratch;               /* edges and spans for SDL_SetRegionRects() */
+    int maxscratch;             /* the number of input rects scratch has room for */
+} SDL_Region;
+
+extern void SDL_InitRegion(SDL_Region * region);
+extern void SDL_FreeRegion(SDL_Region * region);
+
+/* Sets region to the union of the rectangles, which may overlap */
+extern int SDL_SetRegionRects(SDL_Region * region, const SDL_Rect * rects, int numrects);
+
+/* result may be the same region as A or B */
+extern int SDL_UnionRegion(SDL_Region * result, const SDL_Region * A, const SDL_Region * B);
+
+/* Clips region to rect, in place */
+extern void SDL_IntersectRegionRect(SDL_Region * region, const SDL_Rect * rect);
+
+/* Grows region until it has no more than maxrects rectangles, adding as
+   few pixels as the heuristic can find */
+extern int SDL_SimplifyRegion(SDL_Region * region, int maxrects);
+
+#endif /* SDL_region_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
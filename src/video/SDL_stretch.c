@@ -28,6 +28,7 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_blit_threads.h"
 
 /* This isn't ready for general consumption yet - it should be folded
    into the general blitting mechanism.
@@ -196,7 +197,53 @@ copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
     }
 }
 
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    int inc;
+} SDL_StretchRowsData;
+
+static void
+SDL_StretchRows(void *data, int band, int first, int count)
+{
+    const SDL_StretchRowsData *stretch = (const SDL_StretchRowsData *) data;
+    const SDL_Rect *srcrect = stretch->srcrect;
+    const SDL_Rect *dstrect = stretch->dstrect;
+    const int bpp = stretch->dst->format->BytesPerPixel;
+    int row;
+
+    for (row = first; row < first + count; ++row) {
+        /* Row i of the destination comes from source row (i * inc) >> 16 */
+        Uint8 *srcp = (Uint8 *) stretch->src->pixels
+            + (srcrect->y + ((row * stretch->inc) >> 16)) * stretch->src->pitch
+            + (srcrect->x * bpp);
+        Uint8 *dstp = (Uint8 *) stretch->dst->pixels
+            + (dstrect->y + row) * stretch->dst->pitch + (dstrect->x * bpp);
+
+        switch (bpp) {
+        case 1:
+            copy_row1(srcp, srcrect->w, dstp, dstrect->w);
+            break;
+        case 2:
+            copy_row2((Uint16 *) srcp, srcrect->w,
+                      (Uint16 *) dstp, dstrect->w);
+            break;
+        case 3:
+            copy_row3(srcp, srcrect->w, dstp, dstrect->w);
+            break;
+        case 4:
+            copy_row4((Uint32 *) srcp, srcrect->w,
+                      (Uint32 *) dstp, dstrect->w);
+            break;
+        }
+    }
+}
+
 /* Perform a stretch blit between two surfaces of the same format.
+   Large stretches are split into bands of rows, see SDL_GetBlitBands().
    NOTE:  This function is not safe to call from multiple threads!
 */
 int
@@ -205,20 +252,21 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 {
     int src_locked;
     int dst_locked;
-    int pos, inc;
+    int inc;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+#ifdef USE_ASM_STRETCH
+    int pos;
     int dst_maxrow;
     int src_row, dst_row;
     Uint8 *srcp = NULL;
     Uint8 *dstp;
-    SDL_Rect full_src;
-    SDL_Rect full_dst;
-#ifdef USE_ASM_STRETCH
     SDL_bool use_asm = SDL_TRUE;
+    const int bpp = dst->format->BytesPerPixel;
 #ifdef __GNUC__
     int u1, u2;
 #endif
 #endif /* USE_ASM_STRETCH */
-    const int bpp = dst->format->BytesPerPixel;
 
     if (src->format->format != dst->format->format) {
         return SDL_SetError("Only works with same format surfaces");
@@ -273,12 +321,13 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     }
 
     /* Set up the data... */
-    pos = 0x10000;
     inc = (srcrect->h << 16) / dstrect->h;
+
+#ifdef USE_ASM_STRETCH
+    pos = 0x10000;
     src_row = srcrect->y;
     dst_row = dstrect->y;
 
-#ifdef USE_ASM_STRETCH
     /* Write the opcodes for this stretch */
     if ((bpp == 3) || (generate_rowbytes(srcrect->w, dstrect->w, bpp) < 0)) {
         use_asm = SDL_FALSE;
@@ -286,17 +335,17 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 #endif
 
     /* Perform the stretch blit */
-    for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
-        dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
-            + (dstrect->x * bpp);
-        while (pos >= 0x10000L) {
-            srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
-                + (srcrect->x * bpp);
-            ++src_row;
-            pos -= 0x10000L;
-        }
 #ifdef USE_ASM_STRETCH
-        if (use_asm) {
+    if (use_asm) {
+        for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
+            dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
+                + (dstrect->x * bpp);
+            while (pos >= 0x10000L) {
+                srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
+                    + (srcrect->x * bpp);
+                ++src_row;
+                pos -= 0x10000L;
+            }
 #ifdef __GNUC__
             __asm__ __volatile__("call *%4":"=&D"(u1), "=&S"(u2)
                                  :"0"(dstp), "1"(srcp), "r"(copy_row)
@@ -319,27 +368,445 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
 #else
 #error Need inline assembly for this compiler
 #endif
-        } else
+            pos += inc;
+        }
+    } else
+#endif /* USE_ASM_STRETCH */
+    {
+        SDL_StretchRowsData data;
+
+        data.src = src;
+        data.srcrect = srcrect;
+        data.dst = dst;
+        data.dstrect = dstrect;
+        data.inc = inc;
+        SDL_RunBlitBands(SDL_StretchRows, &data, dstrect->h,
+                         SDL_GetBlitBands(dstrect->h, dstrect->w));
+    }
+
+    /* We need to unlock the surfaces if they're locked */
+    if (dst_locked) {
+        SDL_UnlockSurface(dst);
+    }
+    if (src_locked) {
+        SDL_UnlockSurface(src);
+    }
+    return (0);
+}
+
+/* Bilinear stretching for surfaces with four 8-bit channels.
+
+   Samples are taken at pixel centers and clamped to the source rectangle.
+   Every destination row first blends the two source rows it lies between
+   into a row buffer, then every destination pixel blends two neighbouring
+   pixels of that buffer.  Both passes use weights that add up to 256 and
+   round to nearest, and all of the kernels below give identical results.
+*/
+
+typedef struct
+{
+    int x;      /* left source pixel, relative to the source rectangle */
+    int frac;   /* weight of the pixel to its right, 0-255 */
+} SDL_StretchColumn;
+
+typedef void (*SDL_StretchBlendRowsFunc)(const Uint32 *top, const Uint32 *bottom, Uint32 *dst, int width, int frac);
+typedef void (*SDL_StretchFilterRowFunc)(const Uint32 *src, Uint32 *dst, const SDL_StretchColumn *columns, int width);
+
+static SDL_StretchBlendRowsFunc StretchBlendRows;
+static SDL_StretchFilterRowFunc StretchFilterRow;
+
+/* Enough for the row buffer and column table of most sprites */
+#define STRETCH_STACK_BYTES 8192
+
+static SDL_INLINE Uint32
+StretchLerp(Uint32 p0, Uint32 p1, int frac)
+{
+    const Uint32 w0 = 256 - frac;
+    const Uint32 w1 = frac;
+    const Uint32 rb = ((p0 & 0x00FF00FF) * w0 + (p1 & 0x00FF00FF) * w1 + 0x00800080) >> 8;
+    const Uint32 ag = (((p0 >> 8) & 0x00FF00FF) * w0 + ((p1 >> 8) & 0x00FF00FF) * w1 + 0x00800080) >> 8;
+    return (rb & 0x00FF00FF) | ((ag & 0x00FF00FF) << 8);
+}
+
+static void
+StretchBlendRows_Scalar(const Uint32 *top, const Uint32 *bottom, Uint32 *dst, int width, int frac)
+{
+    int i;
+
+    for (i = 0; i < width; ++i) {
+        dst[i] = StretchLerp(top[i], bottom[i], frac);
+    }
+}
+
+static void
+StretchFilterRow_Scalar(const Uint32 *src, Uint32 *dst, const SDL_StretchColumn *columns, int width)
+{
+    int i;
+
+    for (i = 0; i < width; ++i) {
+        const Uint32 *p = &src[columns[i].x];
+        dst[i] = StretchLerp(p[0], p[1], columns[i].frac);
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+static void
+StretchBlendRows_SSE2(const Uint32 *top, const Uint32 *bottom, Uint32 *dst, int width, int frac)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+    const __m128i w0 = _mm_set1_epi16((short)(256 - frac));
+    const __m128i w1 = _mm_set1_epi16((short)frac);
+    int i = 0;
+
+    for (; i + 4 <= width; i += 4) {
+        const __m128i t = _mm_loadu_si128((const __m128i *)&top[i]);
+        const __m128i b = _mm_loadu_si128((const __m128i *)&bottom[i]);
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(t, zero), w0),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(b, zero), w1));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(t, zero), w0),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(b, zero), w1));
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+        _mm_storeu_si128((__m128i *)&dst[i], _mm_packus_epi16(lo, hi));
+    }
+    StretchBlendRows_Scalar(&top[i], &bottom[i], &dst[i], width - i, frac);
+}
+
+static void
+StretchFilterRow_SSE2(const Uint32 *src, Uint32 *dst, const SDL_StretchColumn *columns, int width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+    int i = 0;
+
+    for (; i + 2 <= width; i += 2) {
+        const SDL_StretchColumn *c = &columns[i];
+        /* The left/right pixel pairs for two destination pixels */
+        const __m128i pairs = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)&src[c[0].x]),
+                                                 _mm_loadl_epi64((const __m128i *)&src[c[1].x]));
+        const short a0 = (short)(256 - c[0].frac), a1 = (short)c[0].frac;
+        const short b0 = (short)(256 - c[1].frac), b1 = (short)c[1].frac;
+        const __m128i a = _mm_mullo_epi16(_mm_unpacklo_epi8(pairs, zero), _mm_set_epi16(a1, a1, a1, a1, a0, a0, a0, a0));
+        const __m128i b = _mm_mullo_epi16(_mm_unpackhi_epi8(pairs, zero), _mm_set_epi16(b1, b1, b1, b1, b0, b0, b0, b0));
+        __m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(a, b), _mm_unpackhi_epi64(a, b));
+        sum = _mm_srli_epi16(_mm_add_epi16(sum, round), 8);
+        _mm_storel_epi64((__m128i *)&dst[i], _mm_packus_epi16(sum, sum));
+    }
+    StretchFilterRow_Scalar(src, &dst[i], &columns[i], width - i);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2")
+StretchBlendRows_AVX2(const Uint32 *top, const Uint32 *bottom, Uint32 *dst, int width, int frac)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(128);
+    const __m256i w0 = _mm256_set1_epi16((short)(256 - frac));
+    const __m256i w1 = _mm256_set1_epi16((short)frac);
+    int i = 0;
+
+    /* Unpacking and packing both work within 128-bit lanes, so the pixel order is kept */
+    for (; i + 8 <= width; i += 8) {
+        const __m256i t = _mm256_loadu_si256((const __m256i *)&top[i]);
+        const __m256i b = _mm256_loadu_si256((const __m256i *)&bottom[i]);
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(t, zero), w0),
+                                      _mm256_mullo_epi16(_mm256_unpacklo_epi8(b, zero), w1));
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(t, zero), w0),
+                                      _mm256_mullo_epi16(_mm256_unpackhi_epi8(b, zero), w1));
+        lo = _mm256_srli_epi16(_mm256_add_epi16(lo, round), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(hi, round), 8);
+        _mm256_storeu_si256((__m256i *)&dst[i], _mm256_packus_epi16(lo, hi));
+    }
+    StretchBlendRows_Scalar(&top[i], &bottom[i], &dst[i], width - i, frac);
+}
+
+static void SDL_TARGETING("avx2")
+StretchFilterRow_AVX2(const Uint32 *src, Uint32 *dst, const SDL_StretchColumn *columns, int width)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(128);
+    int i = 0;
+
+    for (; i + 4 <= width; i += 4) {
+        const SDL_StretchColumn *c = &columns[i];
+        /* Pixel pairs for destination pixels 0 and 1 in the low lane, 2 and 3 in the high lane */
+        const __m128i p01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)&src[c[0].x]),
+                                               _mm_loadl_epi64((const __m128i *)&src[c[1].x]));
+        const __m128i p23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)&src[c[2].x]),
+                                               _mm_loadl_epi64((const __m128i *)&src[c[3].x]));
+        const __m256i pairs = _mm256_inserti128_si256(_mm256_castsi128_si256(p01), p23, 1);
+        const short w00 = (short)(256 - c[0].frac), w01 = (short)c[0].frac;
+        const short w10 = (short)(256 - c[1].frac), w11 = (short)c[1].frac;
+        const short w20 = (short)(256 - c[2].frac), w21 = (short)c[2].frac;
+        const short w30 = (short)(256 - c[3].frac), w31 = (short)c[3].frac;
+        const __m256i a = _mm256_mullo_epi16(_mm256_unpacklo_epi8(pairs, zero),
+                                             _mm256_set_epi16(w21, w21, w21, w21, w20, w20, w20, w20,
+                                                              w01, w01, w01, w01, w00, w00, w00, w00));
+        const __m256i b = _mm256_mullo_epi16(_mm256_unpackhi_epi8(pairs, zero),
+                                             _mm256_set_epi16(w31, w31, w31, w31, w30, w30, w30, w30,
+                                                              w11, w11, w11, w11, w10, w10, w10, w10));
+        __m256i sum = _mm256_add_epi16(_mm256_unpacklo_epi64(a, b), _mm256_unpackhi_epi64(a, b));
+        sum = _mm256_srli_epi16(_mm256_add_epi16(sum, round), 8);
+        sum = _mm256_permute4x64_epi64(_mm256_packus_epi16(sum, sum), 0x08);
+        _mm_storeu_si128((__m128i *)&dst[i], _mm256_castsi256_si128(sum));
+    }
+    StretchFilterRow_Scalar(src, &dst[i], &columns[i], width - i);
+}
+#endif /* HAVE_AVX2_INTRINSICS */
+
+#if HAVE_NEON_INTRINSICS
+static void
+StretchBlendRows_NEON(const Uint32 *top, const Uint32 *bottom, Uint32 *dst, int width, int frac)
+{
+    /* Only called for rows between two source rows, so both weights fit in a byte */
+    const uint8x8_t w0 = vdup_n_u8((uint8_t)(256 - frac));
+    const uint8x8_t w1 = vdup_n_u8((uint8_t)frac);
+    int i = 0;
+
+    for (; i + 4 <= width; i += 4) {
+        const uint8x16_t t = vld1q_u8((const uint8_t *)&top[i]);
+        const uint8x16_t b = vld1q_u8((const uint8_t *)&bottom[i]);
+        const uint16x8_t lo = vmlal_u8(vmull_u8(vget_low_u8(t), w0), vget_low_u8(b), w1);
+        const uint16x8_t hi = vmlal_u8(vmull_u8(vget_high_u8(t), w0), vget_high_u8(b), w1);
+        vst1q_u8((uint8_t *)&dst[i], vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+    }
+    StretchBlendRows_Scalar(&top[i], &bottom[i], &dst[i], width - i, frac);
+}
+
+static void
+StretchFilterRow_NEON(const Uint32 *src, Uint32 *dst, const SDL_StretchColumn *columns, int width)
+{
+    int i = 0;
+
+    for (; i + 2 <= width; i += 2) {
+        const SDL_StretchColumn *c = &columns[i];
+        const uint16x8_t pa = vmovl_u8(vld1_u8((const uint8_t *)&src[c[0].x]));
+        const uint16x8_t pb = vmovl_u8(vld1_u8((const uint8_t *)&src[c[1].x]));
+        const uint16x8_t wa = vcombine_u16(vdup_n_u16((uint16_t)(256 - c[0].frac)), vdup_n_u16((uint16_t)c[0].frac));
+        const uint16x8_t wb = vcombine_u16(vdup_n_u16((uint16_t)(256 - c[1].frac)), vdup_n_u16((uint16_t)c[1].frac));
+        const uint16x8_t ma = vmulq_u16(pa, wa);
+        const uint16x8_t mb = vmulq_u16(pb, wb);
+        const uint16x8_t sum = vcombine_u16(vadd_u16(vget_low_u16(ma), vget_high_u16(ma)),
+                                            vadd_u16(vget_low_u16(mb), vget_high_u16(mb)));
+        vst1_u8((uint8_t *)&dst[i], vrshrn_n_u16(sum, 8));
+    }
+    StretchFilterRow_Scalar(src, &dst[i], &columns[i], width - i);
+}
+#endif /* HAVE_NEON_INTRINSICS */
+
+static void
+ChooseStretchKernels(void)
+{
+#if HAVE_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        StretchFilterRow = StretchFilterRow_AVX2;
+        StretchBlendRows = StretchBlendRows_AVX2;
+        return;
+    }
+#endif
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        StretchFilterRow = StretchFilterRow_SSE2;
+        StretchBlendRows = StretchBlendRows_SSE2;
+        return;
+    }
 #endif
-            switch (bpp) {
-            case 1:
-                copy_row1(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 2:
-                copy_row2((Uint16 *) srcp, srcrect->w,
-                          (Uint16 *) dstp, dstrect->w);
-                break;
-            case 3:
-                copy_row3(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 4:
-                copy_row4((Uint32 *) srcp, srcrect->w,
-                          (Uint32 *) dstp, dstrect->w);
-                break;
+#if HAVE_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        StretchFilterRow = StretchFilterRow_NEON;
+        StretchBlendRows = StretchBlendRows_NEON;
+        return;
+    }
+#endif
+    StretchFilterRow = StretchFilterRow_Scalar;
+    StretchBlendRows = StretchBlendRows_Scalar;
+}
+
+/* Find the source pixel to the left of (or above) the center of destination
+   pixel i, and the weight of the pixel after it, in 1/256ths. */
+static void
+StretchPosition(int i, int src_size, int dst_size, int *pos, int *frac)
+{
+    Sint64 p = ((((Sint64)(2 * i + 1)) * src_size) << 16) / (2 * (Sint64)dst_size) - 0x8000;
+
+    if (p < 0) {
+        p = 0;
+    }
+    *pos = (int)(p >> 16);
+    *frac = (int)((p >> 8) & 0xFF);
+    if (*pos >= src_size - 1) {
+        *pos = src_size - 1;
+        *frac = 0;
+    }
+}
+
+SDL_bool
+SDL_SoftStretchLinearSupported(const SDL_PixelFormat * format)
+{
+    if (format->BytesPerPixel != 4 || SDL_ISPIXELFORMAT_INDEXED(format->format)) {
+        return SDL_FALSE;
+    }
+    /* Every channel has to be a whole byte */
+    if (format->Rloss || format->Gloss || format->Bloss ||
+        ((format->Rshift | format->Gshift | format->Bshift | format->Ashift) & 7)) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    const SDL_StretchColumn *columns;
+    Uint32 *rows;   /* a row buffer of srcrect->w + 1 pixels per band */
+} SDL_StretchLinearRowsData;
+
+static void
+SDL_StretchLinearRows(void *data, int band, int first, int count)
+{
+    const SDL_StretchLinearRowsData *stretch = (const SDL_StretchLinearRowsData *) data;
+    SDL_Surface *src = stretch->src;
+    SDL_Surface *dst = stretch->dst;
+    const SDL_Rect *srcrect = stretch->srcrect;
+    const SDL_Rect *dstrect = stretch->dstrect;
+    Uint32 *row = stretch->rows + band * (srcrect->w + 1);
+    int i, y, frac;
+
+    for (i = first; i < first + count; ++i) {
+        const Uint32 *top;
+        Uint32 *dstp = (Uint32 *) ((Uint8 *) dst->pixels + (dstrect->y + i) * dst->pitch) + dstrect->x;
+        /* Without horizontal scaling the filter is a copy, so blend straight into the destination */
+        Uint32 *out = (srcrect->w == dstrect->w) ? dstp : row;
+
+        StretchPosition(i, srcrect->h, dstrect->h, &y, &frac);
+        top = (const Uint32 *) ((const Uint8 *) src->pixels + (srcrect->y + y) * src->pitch) + srcrect->x;
+        if (frac) {
+            StretchBlendRows(top, (const Uint32 *) ((const Uint8 *) top + src->pitch), out, srcrect->w, frac);
+        } else {
+            SDL_memcpy(out, top, srcrect->w * sizeof(Uint32));
+        }
+        if (out == row) {
+            row[srcrect->w] = row[srcrect->w - 1];
+            StretchFilterRow(row, dstp, stretch->columns, dstrect->w);
+        }
+    }
+}
+
+/* Perform a bilinear filtered stretch blit between two surfaces of the same
+   32-bit format.
+*/
+int
+SDL_SoftStretchLinear(SDL_Surface * src, const SDL_Rect * srcrect,
+                      SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    Uint32 stack_buffer[STRETCH_STACK_BYTES / sizeof(Uint32)];
+    void *buffer = stack_buffer;
+    size_t buffer_size;
+    SDL_StretchLinearRowsData data;
+    SDL_StretchColumn *columns;
+    int src_locked;
+    int dst_locked;
+    int i, bands;
+    SDL_Rect full_src;
+    SDL_Rect full_dst;
+
+    if (src->format->format != dst->format->format) {
+        return SDL_SetError("Only works with same format surfaces");
+    }
+    if (!SDL_SoftStretchLinearSupported(src->format)) {
+        return SDL_SetError("Linear stretching needs four 8-bit channels");
+    }
+
+    /* Verify the blit rectangles */
+    if (srcrect) {
+        if ((srcrect->x < 0) || (srcrect->y < 0) ||
+            ((srcrect->x + srcrect->w) > src->w) ||
+            ((srcrect->y + srcrect->h) > src->h)) {
+            return SDL_SetError("Invalid source blit rectangle");
+        }
+    } else {
+        full_src.x = 0;
+        full_src.y = 0;
+        full_src.w = src->w;
+        full_src.h = src->h;
+        srcrect = &full_src;
+    }
+    if (dstrect) {
+        if ((dstrect->x < 0) || (dstrect->y < 0) ||
+            ((dstrect->x + dstrect->w) > dst->w) ||
+            ((dstrect->y + dstrect->h) > dst->h)) {
+            return SDL_SetError("Invalid destination blit rectangle");
+        }
+    } else {
+        full_dst.x = 0;
+        full_dst.y = 0;
+        full_dst.w = dst->w;
+        full_dst.h = dst->h;
+        dstrect = &full_dst;
+    }
+    if (srcrect->w <= 0 || srcrect->h <= 0 || dstrect->w <= 0 || dstrect->h <= 0) {
+        return 0;
+    }
+
+    if (!StretchFilterRow) {
+        ChooseStretchKernels();
+    }
+
+    /* Each band of rows gets a row buffer, with a copy of its last pixel
+       at the end so the filter can always read a pair of pixels */
+    bands = SDL_GetBlitBands(dstrect->h, dstrect->w);
+    buffer_size = dstrect->w * sizeof(SDL_StretchColumn) + bands * (srcrect->w + 1) * sizeof(Uint32);
+    if (buffer_size > sizeof(stack_buffer)) {
+        buffer = SDL_malloc(buffer_size);
+        if (!buffer) {
+            return SDL_OutOfMemory();
+        }
+    }
+    columns = (SDL_StretchColumn *) buffer;
+
+    /* Lock the destination if it's in hardware */
+    dst_locked = 0;
+    if (SDL_MUSTLOCK(dst)) {
+        if (SDL_LockSurface(dst) < 0) {
+            if (buffer != stack_buffer) {
+                SDL_free(buffer);
             }
-        pos += inc;
+            return SDL_SetError("Unable to lock destination surface");
+        }
+        dst_locked = 1;
+    }
+    /* Lock the source if it's in hardware */
+    src_locked = 0;
+    if (SDL_MUSTLOCK(src)) {
+        if (SDL_LockSurface(src) < 0) {
+            if (dst_locked) {
+                SDL_UnlockSurface(dst);
+            }
+            if (buffer != stack_buffer) {
+                SDL_free(buffer);
+            }
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
+    }
+
+    for (i = 0; i < dstrect->w; ++i) {
+        StretchPosition(i, srcrect->w, dstrect->w, &columns[i].x, &columns[i].frac);
     }
 
+    data.src = src;
+    data.srcrect = srcrect;
+    data.dst = dst;
+    data.dstrect = dstrect;
+    data.columns = columns;
+    data.rows = (Uint32 *) &columns[dstrect->w];
+    SDL_RunBlitBands(SDL_StretchLinearRows, &data, dstrect->h, bands);
+
     /* We need to unlock the surfaces if they're locked */
     if (dst_locked) {
         SDL_UnlockSurface(dst);
@@ -347,7 +814,10 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
     if (src_locked) {
         SDL_UnlockSurface(src);
     }
-    return (0);
+    if (buffer != stack_buffer) {
+        SDL_free(buffer);
+    }
+    return 0;
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -25,6 +25,7 @@
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_surfacepool_c.h"
 #include "SDL_yuv_c.h"
 #include "../cpuinfo/SDL_simd.h"
 
@@ -68,12 +69,25 @@ SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height, int depth,
                                Uint32 format)
 {
     SDL_Surface *surface;
-
-    /* The flags are no longer used, make the compiler happy */
-    (void)flags;
+    SDL_bool pooled;
+
+    /* Palettes aren't reset when a surface is recycled, so only pool
+       surfaces that don't have one */
+    pooled = ((flags & SDL_POOLED) && width > 0 && height > 0 &&
+              !SDL_ISPIXELFORMAT_INDEXED(format)) ? SDL_TRUE : SDL_FALSE;
+    if (pooled) {
+        surface = SDL_TakePooledSurface(width, height, format);
+        if (surface) {
+            return surface;
+        }
+    }
 
     /* Allocate the surface */
-    surface = (SDL_Surface *) SDL_calloc(1, sizeof(*surface));
+    if (pooled) {
+        surface = SDL_AllocPooledSurface(width, height);
+    } else {
+        surface = (SDL_Surface *) SDL_calloc(1, sizeof(*surface));
+    }
     if (surface == NULL) {
         SDL_OutOfMemory();
         return NULL;
@@ -503,13 +517,16 @@ SDL_SetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode blendMode)
     status = 0;
     flags = surface->map->info.flags;
     surface->map->info.flags &=
-        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+        ~(SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD);
     switch (blendMode) {
     case SDL_BLENDMODE_NONE:
         break;
     case SDL_BLENDMODE_BLEND:
         surface->map->info.flags |= SDL_COPY_BLEND;
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        surface->map->info.flags |= SDL_COPY_BLEND_PREMULTIPLIED;
+        break;
     case SDL_BLENDMODE_ADD:
         surface->map->info.flags |= SDL_COPY_ADD;
         break;
@@ -540,10 +557,13 @@ SDL_GetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode *blendMode)
     }
 
     switch (surface->map->
-            info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD)) {
+            info.flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD)) {
     case SDL_COPY_BLEND:
         *blendMode = SDL_BLENDMODE_BLEND;
         break;
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        *blendMode = SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+        break;
     case SDL_COPY_ADD:
         *blendMode = SDL_BLENDMODE_ADD;
         break;
@@ -872,6 +892,48 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
     return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
 }
 
+/*
+ * Bilinear filtered scaled blit.  The stretcher only copies pixels, so when
+ * the blit also modulates, blends or converts, the source is stretched into
+ * a temporary surface that is then blitted with the same settings.
+ */
+static int
+SDL_LowerBlitScaledLinear(SDL_Surface * src, SDL_Rect * srcrect,
+                          SDL_Surface * dst, SDL_Rect * dstrect,
+                          Uint32 complex_copy_flags)
+{
+    const SDL_BlitInfo *info = &src->map->info;
+    SDL_Surface *scaled;
+    SDL_BlendMode blendMode;
+    SDL_Rect rect;
+    int retval;
+
+    if (!(info->flags & complex_copy_flags) &&
+        src->format->format == dst->format->format) {
+        return SDL_SoftStretchLinear(src, srcrect, dst, dstrect);
+    }
+
+    scaled = SDL_CreateRGBSurfaceWithFormat(SDL_POOLED, dstrect->w, dstrect->h, 32, src->format->format);
+    if (!scaled) {
+        return -1;
+    }
+    retval = SDL_SoftStretchLinear(src, srcrect, scaled, NULL);
+    if (retval == 0) {
+        SDL_GetSurfaceBlendMode(src, &blendMode);
+        SDL_SetSurfaceColorMod(scaled, info->r, info->g, info->b);
+        SDL_SetSurfaceAlphaMod(scaled, info->a);
+        SDL_SetSurfaceBlendMode(scaled, blendMode);
+
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = dstrect->w;
+        rect.h = dstrect->h;
+        retval = SDL_LowerBlit(scaled, &rect, dst, dstrect);
+    }
+    SDL_FreeSurface(scaled);
+    return retval;
+}
+
 /**
  *  This is a semi-private blit function and it performs low-level surface
  *  scaled blitting only.
@@ -882,10 +944,18 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
 {
     static const Uint32 complex_copy_flags = (
         SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
-        SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+        SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD |
         SDL_COPY_COLORKEY
     );
 
+    /* Filtering only makes sense without a color key, and is done for
+       32-bit formats; anything else falls back to nearest sampling. */
+    if ((src->map->info.flags & SDL_COPY_LINEAR) &&
+        !(src->map->info.flags & SDL_COPY_COLORKEY) &&
+        SDL_SoftStretchLinearSupported(src->format)) {
+        return SDL_LowerBlitScaledLinear(src, srcrect, dst, dstrect, complex_copy_flags);
+    }
+
     if (!(src->map->info.flags & SDL_COPY_NEAREST)) {
         src->map->info.flags |= SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
@@ -1105,9 +1175,11 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_SetClipRect(convert, &surface->clip_rect);
 
     /* Enable alpha blending by default if the new surface has an
-     * alpha channel or alpha modulation */
-    if ((surface->format->Amask && format->Amask) ||
-        (copy_flags & SDL_COPY_MODULATE_ALPHA)) {
+     * alpha channel or alpha modulation, unless the pixels are already
+     * premultiplied */
+    if (((surface->format->Amask && format->Amask) ||
+         (copy_flags & SDL_COPY_MODULATE_ALPHA)) &&
+        !(copy_flags & SDL_COPY_BLEND_PREMULTIPLIED)) {
         SDL_SetSurfaceBlendMode(convert, SDL_BLENDMODE_BLEND);
     }
     if ((copy_flags & SDL_COPY_RLE_DESIRED) || (flags & SDL_RLEACCEL)) {
@@ -1232,6 +1304,70 @@ int SDL_ConvertPixels(int width, int height,
     return SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
 }
 
+/*
+ * Premultiply the alpha of 32-bit pixels with an 8-bit alpha channel in
+ * place, two channels at a time, rounding to the nearest value.
+ */
+static void
+SDL_PremultiplyAlpha8888(int width, int height, void *pixels, int pitch,
+                         Uint32 Amask)
+{
+    Uint32 Ashift = 0;
+    int i;
+
+    while (!((Amask >> Ashift) & 1)) {
+        ++Ashift;
+    }
+
+    while (height--) {
+        Uint32 *pixel = (Uint32 *) pixels;
+
+        for (i = width; i--; ++pixel) {
+            const Uint32 p = *pixel;
+            const Uint32 A = (p >> Ashift) & 0xFF;
+            Uint32 rb, ga;
+
+            if (A == 0xFF) {
+                continue;
+            }
+            rb = (p & 0x00FF00FF) * A + 0x00800080;
+            rb = ((rb + ((rb >> 8) & 0x00FF00FF)) >> 8) & 0x00FF00FF;
+            ga = ((p >> 8) & 0x00FF00FF) * A + 0x00800080;
+            ga = (ga + ((ga >> 8) & 0x00FF00FF)) & 0xFF00FF00;
+            *pixel = ((rb | ga) & ~Amask) | (p & Amask);
+        }
+        pixels = (Uint8 *) pixels + pitch;
+    }
+}
+
+int SDL_PremultiplyAlpha(int width, int height,
+                         Uint32 src_format, const void * src, int src_pitch,
+                         Uint32 dst_format, void * dst, int dst_pitch)
+{
+    int bpp;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    if (!src) {
+        return SDL_InvalidParamError("src");
+    }
+    if (!dst) {
+        return SDL_InvalidParamError("dst");
+    }
+    if (!SDL_PixelFormatEnumToMasks(dst_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask) ||
+        bpp != 32 || SDL_PIXELLAYOUT(dst_format) != SDL_PACKEDLAYOUT_8888 || !Amask) {
+        return SDL_SetError("SDL_PremultiplyAlpha(): Unsupported destination format");
+    }
+
+    if (src != dst || src_format != dst_format) {
+        if (SDL_ConvertPixels(width, height, src_format, src, src_pitch,
+                              dst_format, dst, dst_pitch) < 0) {
+            return -1;
+        }
+    }
+    SDL_PremultiplyAlpha8888(width, height, dst, dst_pitch, Amask);
+    return 0;
+}
+
 /*
  * Free a surface created by the above function.
  */
@@ -1255,12 +1391,18 @@ SDL_FreeSurface(SDL_Surface * surface)
     if (surface->flags & SDL_RLEACCEL) {
         SDL_UnRLESurface(surface, 0);
     }
+    if ((surface->flags & SDL_POOLED) && SDL_ReturnPooledSurface(surface)) {
+        return;
+    }
     if (surface->format) {
         SDL_SetSurfacePalette(surface, NULL);
         SDL_FreeFormat(surface->format);
         surface->format = NULL;
     }
-    if (surface->flags & SDL_PREALLOC) {
+    if (surface->flags & SDL_MAPPED) {
+        /* Release the file mapping */
+        SDL_FreeMappedPixels(surface);
+    } else if (surface->flags & SDL_PREALLOC) {
         /* Don't free */
     } else if (surface->flags & SDL_SIMD_ALIGNED) {
         /* Free aligned */
@@ -0,0 +1,232 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_video.h"
+#include "SDL_atomic.h"
+#include "SDL_blit.h"
+#include "SDL_pixels_c.h"
+#include "SDL_surfacepool_c.h"
+#include "../cpuinfo/SDL_simd.h"
+
+/* Free SDL_POOLED surfaces are kept, pixels and all, so that code creating
+   and freeing the same temporary surfaces every frame stops allocating.
+   The list is kept newest first, and the oldest surfaces are freed when
+   the pool grows past its size.
+*/
+
+#define SDL_SURFACE_POOL_DEFAULT_SIZE   (32 * 1024 * 1024)
+
+typedef struct SDL_PooledSurface
+{
+    SDL_Surface surface;
+    int w, h;                   /* the size the surface was created with */
+    size_t size;                /* bytes of pixels */
+    struct SDL_PooledSurface *next;
+} SDL_PooledSurface;
+
+static SDL_SpinLock SDL_surface_pool_lock;
+static SDL_PooledSurface *SDL_surface_pool = NULL;
+static SDL_SurfacePoolStats SDL_surface_pool_stats = {
+    0, 0, SDL_SURFACE_POOL_DEFAULT_SIZE, 0, 0, 0
+};
+
+static void
+SDL_FreePooledSurfaces(SDL_PooledSurface *pooled)
+{
+    while (pooled) {
+        SDL_PooledSurface *next = pooled->next;
+        SDL_FreeFormat(pooled->surface.format);
+        SDL_SIMDFree(pooled->surface.pixels);
+        SDL_FreeBlitMap(pooled->surface.map);
+        SDL_free(pooled);
+        pooled = next;
+    }
+}
+
+/* Unlinks surfaces from the end of the list until the pool fits in
+   max_bytes, and returns them for freeing outside of the lock */
+static SDL_PooledSurface *
+SDL_TrimSurfacePool(size_t max_bytes)
+{
+    SDL_PooledSurface **prev = &SDL_surface_pool;
+    SDL_PooledSurface *evicted;
+    size_t bytes = 0;
+
+    while (*prev && bytes + (*prev)->size <= max_bytes) {
+        bytes += (*prev)->size;
+        prev = &(*prev)->next;
+    }
+    evicted = *prev;
+    *prev = NULL;
+
+    for (prev = &evicted; *prev; prev = &(*prev)->next) {
+        SDL_surface_pool_stats.surfaces -= 1;
+        SDL_surface_pool_stats.evictions += 1;
+    }
+    SDL_surface_pool_stats.bytes = bytes;
+    return evicted;
+}
+
+SDL_Surface *
+SDL_AllocPooledSurface(int width, int height)
+{
+    SDL_PooledSurface *pooled;
+
+    pooled = (SDL_PooledSurface *) SDL_calloc(1, sizeof(*pooled));
+    if (!pooled) {
+        return NULL;
+    }
+    pooled->w = width;
+    pooled->h = height;
+    pooled->surface.flags = SDL_POOLED;
+    return &pooled->surface;
+}
+
+SDL_Surface *
+SDL_TakePooledSurface(int width, int height, Uint32 format)
+{
+    SDL_PooledSurface **prev;
+    SDL_PooledSurface *pooled = NULL;
+    SDL_Surface *surface;
+    SDL_BlitMap *map;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    for (prev = &SDL_surface_pool; *prev; prev = &(*prev)->next) {
+        if ((*prev)->w == width && (*prev)->h == height &&
+            (*prev)->surface.format->format == format) {
+            pooled = *prev;
+            *prev = pooled->next;
+            SDL_surface_pool_stats.surfaces -= 1;
+            SDL_surface_pool_stats.bytes -= pooled->size;
+            break;
+        }
+    }
+    if (pooled) {
+        SDL_surface_pool_stats.hits += 1;
+    } else {
+        SDL_surface_pool_stats.misses += 1;
+    }
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    if (!pooled) {
+        return NULL;
+    }
+
+    /* Put everything back the way SDL_CreateRGBSurfaceWithFormat() leaves it */
+    surface = &pooled->surface;
+    surface->flags = (SDL_POOLED | SDL_SIMD_ALIGNED);
+    surface->w = pooled->w;
+    surface->h = pooled->h;
+    surface->userdata = NULL;
+    surface->locked = 0;
+    surface->lock_data = NULL;
+    SDL_SetClipRect(surface, NULL);
+    SDL_memset(surface->pixels, 0, pooled->size);
+
+    /* The map was invalidated when the surface was freed, so nothing in it
+       is owned any more */
+    map = surface->map;
+    SDL_zerop(map);
+    map->info.r = 0xFF;
+    map->info.g = 0xFF;
+    map->info.b = 0xFF;
+    map->info.a = 0xFF;
+
+    if (surface->format->Amask) {
+        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
+    }
+    surface->refcount = 1;
+    return surface;
+}
+
+SDL_bool
+SDL_ReturnPooledSurface(SDL_Surface * surface)
+{
+    SDL_PooledSurface *pooled = (SDL_PooledSurface *) surface;
+    SDL_PooledSurface *evicted;
+
+    /* Only keep surfaces that still own the buffer they were created with */
+    if (!(surface->flags & SDL_POOLED) || !(surface->flags & SDL_SIMD_ALIGNED) ||
+        (surface->flags & (SDL_PREALLOC | SDL_RLEACCEL | SDL_MAPPED)) ||
+        !surface->pixels || !surface->format || !surface->map ||
+        surface->format->palette) {
+        return SDL_FALSE;
+    }
+    pooled->size = (size_t) pooled->h * surface->pitch;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    if (pooled->size > SDL_surface_pool_stats.max_bytes) {
+        SDL_AtomicUnlock(&SDL_surface_pool_lock);
+        return SDL_FALSE;
+    }
+    pooled->next = SDL_surface_pool;
+    SDL_surface_pool = pooled;
+    SDL_surface_pool_stats.surfaces += 1;
+    SDL_surface_pool_stats.bytes += pooled->size;
+    evicted = SDL_TrimSurfacePool(SDL_surface_pool_stats.max_bytes);
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    SDL_FreePooledSurfaces(evicted);
+    return SDL_TRUE;
+}
+
+void
+SDL_SetSurfacePoolSize(size_t max_bytes)
+{
+    SDL_PooledSurface *evicted;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    SDL_surface_pool_stats.max_bytes = max_bytes;
+    evicted = SDL_TrimSurfacePool(max_bytes);
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    SDL_FreePooledSurfaces(evicted);
+}
+
+void
+SDL_GetSurfacePoolStats(SDL_SurfacePoolStats * stats)
+{
+    if (!stats) {
+        SDL_InvalidParamError("stats");
+        return;
+    }
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    *stats = SDL_surface_pool_stats;
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+}
+
+void
+SDL_QuitSurfacePool(void)
+{
+    SDL_PooledSurface *pooled;
+
+    SDL_AtomicLock(&SDL_surface_pool_lock);
+    pooled = SDL_surface_pool;
+    SDL_surface_pool = NULL;
+    SDL_zero(SDL_surface_pool_stats);
+    SDL_surface_pool_stats.max_bytes = SDL_SURFACE_POOL_DEFAULT_SIZE;
+    SDL_AtomicUnlock(&SDL_surface_pool_lock);
+
+    SDL_FreePooledSurfaces(pooled);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,42 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef SDL_surfacepool_c_h_
+#define SDL_surfacepool_c_h_
+
+/* Recycling of SDL_POOLED surfaces, keyed by (w, h, format) */
+
+/* Allocates an empty surface that can be returned to the pool later */
+extern SDL_Surface *SDL_AllocPooledSurface(int width, int height);
+
+/* Returns a surface freed earlier with the same size and format, reset to
+   the state of a newly created surface, or NULL if there is none */
+extern SDL_Surface *SDL_TakePooledSurface(int width, int height, Uint32 format);
+
+/* Keeps the pixels, format and map of a surface whose last reference was
+   just released. Returns SDL_FALSE if the surface should be freed instead. */
+extern SDL_bool SDL_ReturnPooledSurface(SDL_Surface * surface);
+
+extern void SDL_QuitSurfacePool(void);
+
+#endif /* SDL_surfacepool_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
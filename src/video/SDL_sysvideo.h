@@ -28,6 +28,7 @@
 #include "SDL_thread.h"
 
 #include "SDL_vulkan_internal.h"
+#include "SDL_region_c.h"
 
 /* The SDL video driver */
 
@@ -96,6 +97,7 @@ struct SDL_Window
 
     SDL_Surface *surface;
     SDL_bool surface_valid;
+    SDL_Region update_region;   /* scratch space for SDL_UpdateWindowSurfaceRects() */
 
     SDL_bool is_hiding;
     SDL_bool is_destroying;
@@ -106,6 +108,9 @@ struct SDL_Window
     SDL_HitTest hit_test;
     void *hit_test_data;
 
+    SDL_WindowFrameCallback frame_callback;
+    void *frame_callback_data;
+
     SDL_WindowUserData *data;
 
     void *driverdata;
@@ -416,6 +421,7 @@ extern VideoBootStrap PSP_bootstrap;
 extern VideoBootStrap RPI_bootstrap;
 extern VideoBootStrap KMSDRM_bootstrap;
 extern VideoBootStrap DUMMY_bootstrap;
+extern VideoBootStrap OFFSCREEN_bootstrap;
 extern VideoBootStrap Wayland_bootstrap;
 extern VideoBootStrap NACL_bootstrap;
 extern VideoBootStrap VIVANTE_bootstrap;
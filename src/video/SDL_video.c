@@ -111,6 +111,9 @@ static VideoBootStrap *bootstrap[] = {
 #endif
 #if SDL_VIDEO_DRIVER_DUMMY
     &DUMMY_bootstrap,
+#endif
+#if SDL_VIDEO_DRIVER_OFFSCREEN
+    &OFFSCREEN_bootstrap,
 #endif
     NULL
 };
@@ -143,6 +146,9 @@ static SDL_VideoDevice *_this = NULL;
 
 #define FULLSCREEN_MASK (SDL_WINDOW_FULLSCREEN_DESKTOP | SDL_WINDOW_FULLSCREEN)
 
+/* Window surface updates are merged into no more rectangles than this */
+#define SDL_WINDOW_UPDATE_MAX_RECTS 16
+
 #ifdef __MACOSX__
 /* Support for Mac OS X fullscreen spaces */
 extern SDL_bool Cocoa_IsWindowInFullscreenSpace(SDL_Window * window);
@@ -2324,13 +2330,38 @@ int
 SDL_UpdateWindowSurfaceRects(SDL_Window * window, const SDL_Rect * rects,
                              int numrects)
 {
+    SDL_Region *region;
+    SDL_Rect bounds;
+
     CHECK_WINDOW_MAGIC(window, -1);
 
     if (!window->surface_valid) {
         return SDL_SetError("Window surface is invalid, please call SDL_GetWindowSurface() to get a new surface");
     }
 
-    return _this->UpdateWindowFramebuffer(_this, window, rects, numrects);
+    /* Merge overlapping and fragmented rects, so the driver copies each
+       pixel once and in as few pieces as possible */
+    region = &window->update_region;
+    bounds.x = 0;
+    bounds.y = 0;
+    bounds.w = window->surface->w;
+    bounds.h = window->surface->h;
+    if (SDL_SetRegionRects(region, rects, numrects) == 0) {
+        SDL_IntersectRegionRect(region, &bounds);
+        if (SDL_SimplifyRegion(region, SDL_WINDOW_UPDATE_MAX_RECTS) == 0) {
+            rects = region->rects;
+            numrects = region->numrects;
+        }
+    }
+
+    if (_this->UpdateWindowFramebuffer(_this, window, rects, numrects) < 0) {
+        return -1;
+    }
+
+    if (window->frame_callback) {
+        window->frame_callback(window, window->surface, rects, numrects, window->frame_callback_data);
+    }
+    return 0;
 }
 
 int
@@ -2737,6 +2768,7 @@ SDL_DestroyWindow(SDL_Window * window)
     SDL_free(window->title);
     SDL_FreeSurface(window->icon);
     SDL_free(window->gamma);
+    SDL_FreeRegion(&window->update_region);
     while (window->data) {
         SDL_WindowUserData *data = window->data;
 
@@ -3984,6 +4016,17 @@ SDL_SetWindowHitTest(SDL_Window * window, SDL_HitTest callback, void *userdata)
     return 0;
 }
 
+int
+SDL_SetWindowFrameCallback(SDL_Window * window, SDL_WindowFrameCallback callback, void *userdata)
+{
+    CHECK_WINDOW_MAGIC(window, -1);
+
+    window->frame_callback = callback;
+    window->frame_callback_data = userdata;
+
+    return 0;
+}
+
 float
 SDL_ComputeDiagonalDPI(int hpix, int vpix, float hinches, float vinches)
 {
@@ -20,10 +20,13 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_atomic.h"
 #include "SDL_endian.h"
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "SDL_blit.h"
+#include "SDL_blit_threads.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
@@ -179,6 +182,115 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
+static SDL_bool yuv_rgb_avx2(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height, 
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
+    Uint8 *rgb, Uint32 rgb_stride, 
+    YCbCrType yuv_type)
+{
+#if defined(__SSE2__) && defined(HAVE_AVX2_INTRINSICS)
+    if (!SDL_HasAVX2()) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_sse(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height, 
@@ -391,6 +503,63 @@ static SDL_bool yuv_rgb_std(
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height, 
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride, 
+    Uint8 *rgb, Uint32 rgb_stride, 
+    YCbCrType yuv_type)
+{
+    /* There are no NEON kernels; ARM uses the C conversion, split into row bands */
+    if (yuv_rgb_avx2(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type)) {
+        return SDL_TRUE;
+    }
+    return yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+}
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    int width;
+    int height;
+    int rows_per_uv;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+    SDL_bool converted;
+} SDL_YUVToRGBBands;
+
+/* Bands are counted in rows of the U and V planes, so that the lines sharing
+   U and V values are converted together */
+static void
+SDL_ConvertYUVToRGBBand(void *data, int band, int first, int count)
+{
+    SDL_YUVToRGBBands *bands = (SDL_YUVToRGBBands *) data;
+    const int ypos = first * bands->rows_per_uv;
+    const int height = SDL_min(count * bands->rows_per_uv, bands->height - ypos);
+    SDL_bool converted;
+
+    converted = yuv_rgb(bands->src_format, bands->dst_format, bands->width, height,
+                        bands->y + ypos * bands->y_stride,
+                        bands->u + first * bands->uv_stride,
+                        bands->v + first * bands->uv_stride,
+                        bands->y_stride, bands->uv_stride,
+                        bands->rgb + ypos * bands->rgb_stride, bands->rgb_stride,
+                        bands->yuv_type);
+    if (band == 0) {
+        bands->converted = converted;
+    }
+}
+
 int
 SDL_ConvertPixels_YUV_to_RGB(int width, int height,
          Uint32 src_format, const void *src, int src_pitch,
@@ -402,6 +571,8 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     Uint32 y_stride = 0;
     Uint32 uv_stride = 0;
     YCbCrType yuv_type = YCBCR_601;
+    SDL_YUVToRGBBands bands;
+    int rows;
 
     if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
         return -1;
@@ -411,11 +582,24 @@ SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
-    if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
-        return 0;
-    }
-
-    if (yuv_rgb_std(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8*)dst, dst_pitch, yuv_type)) {
+    bands.src_format = src_format;
+    bands.dst_format = dst_format;
+    bands.width = width;
+    bands.height = height;
+    bands.rows_per_uv = IsPlanar2x2Format(src_format) ? 2 : 1;
+    bands.y = y;
+    bands.u = u;
+    bands.v = v;
+    bands.y_stride = y_stride;
+    bands.uv_stride = uv_stride;
+    bands.rgb = (Uint8 *)dst;
+    bands.rgb_stride = dst_pitch;
+    bands.yuv_type = yuv_type;
+    bands.converted = SDL_FALSE;
+    rows = (height + bands.rows_per_uv - 1) / bands.rows_per_uv;
+    SDL_RunBlitBands(SDL_ConvertYUVToRGBBand, &bands, rows,
+                     SDL_GetBlitBands(rows, width * bands.rows_per_uv));
+    if (bands.converted) {
         return 0;
     }
 
@@ -454,17 +638,26 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
-static int
-SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+/* The conversion is done in fixed point with 14 fractional bits, which keeps
+   the products of 8-bit channels and factors in 16-bit x 16-bit multiplies.
+   The SIMD kernels use the same arithmetic, so they match the C ones exactly.
+*/
+#define RGB2YUV_SHIFT   14
+#define RGB2YUV_FIXED(f) ((int)((f) * (1 << RGB2YUV_SHIFT) + ((f) < 0.0f ? -0.5f : 0.5f)))
+
+typedef struct
 {
-    const int src_pitch_x_2    = src_pitch * 2;
-    const int height_half      = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half       = width / 2;
-    const int width_remainder  = (width & 0x1);
-    int i, j;
- 
-    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
+    int y[3];       /* Rfactor, Gfactor, Bfactor */
+    int u[3];       /* Rfactor, Gfactor, Bfactor */
+    int v[3];       /* Rfactor, Gfactor, Bfactor */
+    int y_bias;     /* Offset and rounding, pre-shifted */
+    int uv_bias;    /* Offset and rounding, pre-shifted */
+} RGB2YUVCoefficients;
+
+static void
+GetRGB2YUVCoefficients(SDL_YUV_CONVERSION_MODE mode, RGB2YUVCoefficients *cvt)
+{
+    static const struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] =
     {
         /* ITU-T T.871 (JPEG) */
         {
@@ -488,55 +681,407 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
             { 0.4392f, -0.3989f, -0.0403f },
         },
     };
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
-
-#define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
-#define MAKE_U(r, g, b) (Uint8)((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128)
-#define MAKE_V(r, g, b) (Uint8)((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128)
-
-#define READ_2x2_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-        const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2;  \
-
-#define READ_2x1_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];                                                    \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17;                                         \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;                                          \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;                                          \
-
-#define READ_1x2_PIXELS                                                                                         \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-        const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17;                                         \
-        const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;                                          \
-        const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1;                                          \
-
-#define READ_1x1_PIXEL                                                                                          \
-        const Uint32 p = ((const Uint32 *)curr_row)[2 * i];                                                     \
-        const Uint32 r = (p & 0x00ff0000) >> 16;                                                                \
-        const Uint32 g = (p & 0x0000ff00) >> 8;                                                                 \
-        const Uint32 b = (p & 0x000000ff);                                                                      \
-
-#define READ_TWO_RGB_PIXELS                                                                                     \
-        const Uint32 p = ((const Uint32 *)curr_row)[2 * i];                                                     \
-        const Uint32 r = (p & 0x00ff0000) >> 16;                                                                \
-        const Uint32 g = (p & 0x0000ff00) >> 8;                                                                 \
-        const Uint32 b = (p & 0x000000ff);                                                                      \
-        const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-        const Uint32 r1 = (p1 & 0x00ff0000) >> 16;                                                              \
-        const Uint32 g1 = (p1 & 0x0000ff00) >> 8;                                                               \
-        const Uint32 b1 = (p1 & 0x000000ff);                                                                    \
-        const Uint32 R = (r + r1)/2;                                                                            \
-        const Uint32 G = (g + g1)/2;                                                                            \
-        const Uint32 B = (b + b1)/2;                                                                            \
-
-#define READ_ONE_RGB_PIXEL  READ_1x1_PIXEL
+    const struct RGB2YUVFactors *factors = &RGB2YUVFactorTables[mode];
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        cvt->y[i] = RGB2YUV_FIXED(factors->y[i]);
+        cvt->u[i] = RGB2YUV_FIXED(factors->u[i]);
+        cvt->v[i] = RGB2YUV_FIXED(factors->v[i]);
+    }
+    cvt->y_bias = (factors->y_offset << RGB2YUV_SHIFT) + (1 << (RGB2YUV_SHIFT - 1));
+    cvt->uv_bias = (128 << RGB2YUV_SHIFT) + (1 << (RGB2YUV_SHIFT - 1));
+}
+
+/* Row kernels. The sources are ARGB8888 rows, the alpha channel is ignored.
+   RowUV averages 2x2 blocks of row0 and row1 into one U and V sample each,
+   passing the same row twice averages horizontal pairs only. An odd last
+   column is averaged with itself.
+*/
+typedef void (*RGB2YUV_RowYFunc)(const Uint32 *src, Uint8 *y, int width, const RGB2YUVCoefficients *cvt);
+typedef void (*RGB2YUV_RowUVFunc)(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVCoefficients *cvt);
+typedef void (*RGB2YUV_RowPackedFunc)(const Uint32 *src, Uint8 *dst, Uint32 dst_format, int width, const RGB2YUVCoefficients *cvt);
+
+typedef struct
+{
+    RGB2YUV_RowYFunc RowY;
+    RGB2YUV_RowUVFunc RowUV;
+    RGB2YUV_RowPackedFunc RowPacked;
+} RGB2YUVKernels;
+
+/* The chosen const RGB2YUVKernels, published with SDL_AtomicSetPtr() */
+static void *RGB2YUV_kernels = NULL;
+
+#define RGB2YUV_CLAMP(x) (Uint8)((x) < 0 ? 0 : ((x) > 255 ? 255 : (x)))
+#define RGB2YUV_DOT(f, r, g, b, bias) ((int)((f)[0] * (r) + (f)[1] * (g) + (f)[2] * (b) + (bias)) >> RGB2YUV_SHIFT)
+#define MAKE_Y(r, g, b) RGB2YUV_CLAMP(RGB2YUV_DOT(cvt->y, r, g, b, cvt->y_bias))
+#define MAKE_U(r, g, b) RGB2YUV_CLAMP(RGB2YUV_DOT(cvt->u, r, g, b, cvt->uv_bias))
+#define MAKE_V(r, g, b) RGB2YUV_CLAMP(RGB2YUV_DOT(cvt->v, r, g, b, cvt->uv_bias))
+
+static void
+RGB2YUV_RowY_C(const Uint32 *src, Uint8 *y, int width, const RGB2YUVCoefficients *cvt)
+{
+    int i;
+
+    for (i = 0; i < width; ++i) {
+        const Uint32 p = src[i];
+        const int r = (int)((p & 0x00ff0000) >> 16);
+        const int g = (int)((p & 0x0000ff00) >> 8);
+        const int b = (int)(p & 0x000000ff);
+        y[i] = MAKE_Y(r, g, b);
+    }
+}
+
+static void
+RGB2YUV_RowUV_C(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVCoefficients *cvt)
+{
+    int i;
+
+    for (i = 0; i < width; i += 2) {
+        const int i1 = (i + 1 < width) ? (i + 1) : i;
+        const Uint32 p1 = row0[i];
+        const Uint32 p2 = row0[i1];
+        const Uint32 p3 = row1[i];
+        const Uint32 p4 = row1[i1];
+        const int r = (int)(((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18);
+        const int g = (int)(((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10);
+        const int b = (int)(((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2);
+        *u = MAKE_U(r, g, b);
+        *v = MAKE_V(r, g, b);
+        u += uv_step;
+        v += uv_step;
+    }
+}
+
+static void
+RGB2YUV_RowPacked_C(const Uint32 *src, Uint8 *dst, Uint32 dst_format, int width, const RGB2YUVCoefficients *cvt)
+{
+    int y0, y1, u, v;
+    int i;
+
+    switch (dst_format) {
+    case SDL_PIXELFORMAT_YUY2:
+        /* Y U Y1 V */
+        y0 = 0; u = 1; y1 = 2; v = 3;
+        break;
+    case SDL_PIXELFORMAT_UYVY:
+        /* U Y V Y1 */
+        u = 0; y0 = 1; v = 2; y1 = 3;
+        break;
+    default:
+        /* Y V Y1 U */
+        y0 = 0; v = 1; y1 = 2; u = 3;
+        break;
+    }
+
+    for (i = 0; i < width; i += 2) {
+        const Uint32 p = src[i];
+        const Uint32 p1 = (i + 1 < width) ? src[i + 1] : p;
+        const int r = (int)((p & 0x00ff0000) >> 16);
+        const int g = (int)((p & 0x0000ff00) >> 8);
+        const int b = (int)(p & 0x000000ff);
+        const int r1 = (int)((p1 & 0x00ff0000) >> 16);
+        const int g1 = (int)((p1 & 0x0000ff00) >> 8);
+        const int b1 = (int)(p1 & 0x000000ff);
+        const int R = (r + r1) / 2;
+        const int G = (g + g1) / 2;
+        const int B = (b + b1) / 2;
+        dst[y0] = MAKE_Y(r, g, b);
+        dst[u] = MAKE_U(R, G, B);
+        dst[y1] = MAKE_Y(r1, g1, b1);
+        dst[v] = MAKE_V(R, G, B);
+        dst += 4;
+    }
+}
+
+#if HAVE_SSE2_INTRINSICS
+/* Pixels unpacked to 16-bit lanes are B, G, R, A in memory order, so the
+   factors are set up to match, with 0 for alpha. */
+#define RGB2YUV_FACTORS_SSE2(f) _mm_set_epi16(0, (short)(f)[0], (short)(f)[1], (short)(f)[2], 0, (short)(f)[0], (short)(f)[1], (short)(f)[2])
+
+/* Dot products of the four unpacked pixels in p01 and p23 with f */
+static SDL_INLINE __m128i
+RGB2YUV_Dot_SSE2(__m128i p01, __m128i p23, __m128i f, __m128i bias)
+{
+    const __m128 a = _mm_castsi128_ps(_mm_madd_epi16(p01, f));
+    const __m128 b = _mm_castsi128_ps(_mm_madd_epi16(p23, f));
+    const __m128i sum = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+                                      _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+    return _mm_srai_epi32(_mm_add_epi32(sum, bias), RGB2YUV_SHIFT);
+}
+
+/* 8 Y values as 16-bit lanes */
+static SDL_INLINE __m128i
+RGB2YUV_Y8_SSE2(const Uint32 *src, __m128i f, __m128i bias)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i a = _mm_loadu_si128((const __m128i *)src);
+    const __m128i b = _mm_loadu_si128((const __m128i *)(src + 4));
+    return _mm_packs_epi32(RGB2YUV_Dot_SSE2(_mm_unpacklo_epi8(a, zero), _mm_unpackhi_epi8(a, zero), f, bias),
+                           RGB2YUV_Dot_SSE2(_mm_unpacklo_epi8(b, zero), _mm_unpackhi_epi8(b, zero), f, bias));
+}
+
+/* The 2x2 averages of 4 columns of row0 and row1, as two unpacked pixels */
+static SDL_INLINE __m128i
+RGB2YUV_Average_SSE2(const Uint32 *row0, const Uint32 *row1)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i a = _mm_loadu_si128((const __m128i *)row0);
+    const __m128i b = _mm_loadu_si128((const __m128i *)row1);
+    const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+    return _mm_srli_epi16(_mm_add_epi16(_mm_unpacklo_epi64(lo, hi), _mm_unpackhi_epi64(lo, hi)), 2);
+}
+
+/* U0-U7 and V0-V7 for 16 columns of row0 and row1 */
+static SDL_INLINE __m128i
+RGB2YUV_UV8_SSE2(const Uint32 *row0, const Uint32 *row1, __m128i fu, __m128i fv, __m128i bias)
+{
+    const __m128i q01 = RGB2YUV_Average_SSE2(row0, row1);
+    const __m128i q23 = RGB2YUV_Average_SSE2(row0 + 4, row1 + 4);
+    const __m128i q45 = RGB2YUV_Average_SSE2(row0 + 8, row1 + 8);
+    const __m128i q67 = RGB2YUV_Average_SSE2(row0 + 12, row1 + 12);
+    const __m128i u = _mm_packs_epi32(RGB2YUV_Dot_SSE2(q01, q23, fu, bias), RGB2YUV_Dot_SSE2(q45, q67, fu, bias));
+    const __m128i v = _mm_packs_epi32(RGB2YUV_Dot_SSE2(q01, q23, fv, bias), RGB2YUV_Dot_SSE2(q45, q67, fv, bias));
+    return _mm_packus_epi16(u, v);
+}
+
+static SDL_INLINE void
+RGB2YUV_StoreUV_SSE2(__m128i uv, Uint8 *u, Uint8 *v, int uv_step)
+{
+    const __m128i vu = _mm_srli_si128(uv, 8);
+
+    if (uv_step == 1) {
+        _mm_storel_epi64((__m128i *)u, uv);
+        _mm_storel_epi64((__m128i *)v, vu);
+    } else if (u < v) {
+        _mm_storeu_si128((__m128i *)u, _mm_unpacklo_epi8(uv, vu));
+    } else {
+        _mm_storeu_si128((__m128i *)v, _mm_unpacklo_epi8(vu, uv));
+    }
+}
+
+/* Interleave 16 Y values with U0-U7 and V0-V7 into 8 packed pixel pairs */
+static SDL_INLINE void
+RGB2YUV_StorePacked_SSE2(__m128i y, __m128i uv, Uint8 *dst, Uint32 dst_format)
+{
+    const __m128i vu = _mm_srli_si128(uv, 8);
+
+    if (dst_format == SDL_PIXELFORMAT_YUY2) {
+        const __m128i c = _mm_unpacklo_epi8(uv, vu);
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(y, c));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(y, c));
+    } else if (dst_format == SDL_PIXELFORMAT_UYVY) {
+        const __m128i c = _mm_unpacklo_epi8(uv, vu);
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(c, y));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(c, y));
+    } else {
+        const __m128i c = _mm_unpacklo_epi8(vu, uv);
+        _mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi8(y, c));
+        _mm_storeu_si128((__m128i *)(dst + 16), _mm_unpackhi_epi8(y, c));
+    }
+}
+
+static void
+RGB2YUV_RowY_SSE2(const Uint32 *src, Uint8 *y, int width, const RGB2YUVCoefficients *cvt)
+{
+    const __m128i f = RGB2YUV_FACTORS_SSE2(cvt->y);
+    const __m128i bias = _mm_set1_epi32(cvt->y_bias);
+    int i = 0;
+
+    for (; i + 16 <= width; i += 16) {
+        _mm_storeu_si128((__m128i *)&y[i], _mm_packus_epi16(RGB2YUV_Y8_SSE2(&src[i], f, bias),
+                                                            RGB2YUV_Y8_SSE2(&src[i + 8], f, bias)));
+    }
+    RGB2YUV_RowY_C(&src[i], &y[i], width - i, cvt);
+}
+
+static void
+RGB2YUV_RowUV_SSE2(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVCoefficients *cvt)
+{
+    const __m128i fu = RGB2YUV_FACTORS_SSE2(cvt->u);
+    const __m128i fv = RGB2YUV_FACTORS_SSE2(cvt->v);
+    const __m128i bias = _mm_set1_epi32(cvt->uv_bias);
+    int i = 0;
+
+    for (; i + 16 <= width; i += 16) {
+        RGB2YUV_StoreUV_SSE2(RGB2YUV_UV8_SSE2(&row0[i], &row1[i], fu, fv, bias), u, v, uv_step);
+        u += 8 * uv_step;
+        v += 8 * uv_step;
+    }
+    RGB2YUV_RowUV_C(&row0[i], &row1[i], u, v, uv_step, width - i, cvt);
+}
+
+static void
+RGB2YUV_RowPacked_SSE2(const Uint32 *src, Uint8 *dst, Uint32 dst_format, int width, const RGB2YUVCoefficients *cvt)
+{
+    const __m128i fy = RGB2YUV_FACTORS_SSE2(cvt->y);
+    const __m128i fu = RGB2YUV_FACTORS_SSE2(cvt->u);
+    const __m128i fv = RGB2YUV_FACTORS_SSE2(cvt->v);
+    const __m128i y_bias = _mm_set1_epi32(cvt->y_bias);
+    const __m128i uv_bias = _mm_set1_epi32(cvt->uv_bias);
+    int i = 0;
+
+    for (; i + 16 <= width; i += 16) {
+        const __m128i y = _mm_packus_epi16(RGB2YUV_Y8_SSE2(&src[i], fy, y_bias),
+                                           RGB2YUV_Y8_SSE2(&src[i + 8], fy, y_bias));
+        RGB2YUV_StorePacked_SSE2(y, RGB2YUV_UV8_SSE2(&src[i], &src[i], fu, fv, uv_bias), dst, dst_format);
+        dst += 32;
+    }
+    RGB2YUV_RowPacked_C(&src[i], dst, dst_format, width - i, cvt);
+}
+#endif /* HAVE_SSE2_INTRINSICS */
+
+#if HAVE_AVX2_INTRINSICS && HAVE_SSE2_INTRINSICS
+#define RGB2YUV_FACTORS_AVX2(f) _mm256_inserti128_si256(_mm256_castsi128_si256(RGB2YUV_FACTORS_SSE2(f)), RGB2YUV_FACTORS_SSE2(f), 1)
+
+/* Dot products of the unpacked pixels, p holds pixels 0, 1, 4, 5 and q
+   holds pixels 2, 3, 6, 7. The results are in pixel order. */
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+RGB2YUV_Dot_AVX2(__m256i p, __m256i q, __m256i f, __m256i bias)
+{
+    const __m256 a = _mm256_castsi256_ps(_mm256_madd_epi16(p, f));
+    const __m256 b = _mm256_castsi256_ps(_mm256_madd_epi16(q, f));
+    const __m256i sum = _mm256_add_epi32(_mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+                                         _mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+    return _mm256_srai_epi32(_mm256_add_epi32(sum, bias), RGB2YUV_SHIFT);
+}
+
+/* 16 Y values as bytes */
+static SDL_INLINE __m128i SDL_TARGETING("avx2")
+RGB2YUV_Y16_AVX2(const Uint32 *src, __m256i f, __m256i bias)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i a = _mm256_loadu_si256((const __m256i *)src);
+    const __m256i b = _mm256_loadu_si256((const __m256i *)(src + 8));
+    __m256i y = _mm256_packs_epi32(RGB2YUV_Dot_AVX2(_mm256_unpacklo_epi8(a, zero), _mm256_unpackhi_epi8(a, zero), f, bias),
+                                   RGB2YUV_Dot_AVX2(_mm256_unpacklo_epi8(b, zero), _mm256_unpackhi_epi8(b, zero), f, bias));
+    y = _mm256_permute4x64_epi64(y, _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_packus_epi16(_mm256_castsi256_si128(y), _mm256_extracti128_si256(y, 1));
+}
+
+/* The 2x2 averages of 8 columns of row0 and row1, in the order 0, 1, 2, 3
+   across the two lanes */
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+RGB2YUV_Average_AVX2(const Uint32 *row0, const Uint32 *row1)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i a = _mm256_loadu_si256((const __m256i *)row0);
+    const __m256i b = _mm256_loadu_si256((const __m256i *)row1);
+    const __m256i lo = _mm256_add_epi16(_mm256_unpacklo_epi8(a, zero), _mm256_unpacklo_epi8(b, zero));
+    const __m256i hi = _mm256_add_epi16(_mm256_unpackhi_epi8(a, zero), _mm256_unpackhi_epi8(b, zero));
+    return _mm256_srli_epi16(_mm256_add_epi16(_mm256_unpacklo_epi64(lo, hi), _mm256_unpackhi_epi64(lo, hi)), 2);
+}
+
+/* U0-U7 and V0-V7 for 16 columns of row0 and row1 */
+static SDL_INLINE __m128i SDL_TARGETING("avx2")
+RGB2YUV_UV8_AVX2(const Uint32 *row0, const Uint32 *row1, __m256i fu, __m256i fv, __m256i bias)
+{
+    /* The dot products come out as 0, 1, 4, 5, 2, 3, 6, 7 */
+    const __m256i q0123 = RGB2YUV_Average_AVX2(row0, row1);
+    const __m256i q4567 = RGB2YUV_Average_AVX2(row0 + 8, row1 + 8);
+    const __m256i u = _mm256_permute4x64_epi64(RGB2YUV_Dot_AVX2(q0123, q4567, fu, bias), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m256i v = _mm256_permute4x64_epi64(RGB2YUV_Dot_AVX2(q0123, q4567, fv, bias), _MM_SHUFFLE(3, 1, 2, 0));
+    const __m256i uv = _mm256_permute4x64_epi64(_mm256_packs_epi32(u, v), _MM_SHUFFLE(3, 1, 2, 0));
+    return _mm_packus_epi16(_mm256_castsi256_si128(uv), _mm256_extracti128_si256(uv, 1));
+}
+
+static void SDL_TARGETING("avx2")
+RGB2YUV_RowY_AVX2(const Uint32 *src, Uint8 *y, int width, const RGB2YUVCoefficients *cvt)
+{
+    const __m256i f = RGB2YUV_FACTORS_AVX2(cvt->y);
+    const __m256i bias = _mm256_set1_epi32(cvt->y_bias);
+    int i = 0;
+
+    for (; i + 16 <= width; i += 16) {
+        _mm_storeu_si128((__m128i *)&y[i], RGB2YUV_Y16_AVX2(&src[i], f, bias));
+    }
+    RGB2YUV_RowY_C(&src[i], &y[i], width - i, cvt);
+}
+
+static void SDL_TARGETING("avx2")
+RGB2YUV_RowUV_AVX2(const Uint32 *row0, const Uint32 *row1, Uint8 *u, Uint8 *v, int uv_step, int width, const RGB2YUVCoefficients *cvt)
+{
+    const __m256i fu = RGB2YUV_FACTORS_AVX2(cvt->u);
+    const __m256i fv = RGB2YUV_FACTORS_AVX2(cvt->v);
+    const __m256i bias = _mm256_set1_epi32(cvt->uv_bias);
+    int i = 0;
+
+    for (; i + 16 <= width; i += 16) {
+        RGB2YUV_StoreUV_SSE2(RGB2YUV_UV8_AVX2(&row0[i], &row1[i], fu, fv, bias), u, v, uv_step);
+        u += 8 * uv_step;
+        v += 8 * uv_step;
+    }
+    RGB2YUV_RowUV_C(&row0[i], &row1[i], u, v, uv_step, width - i, cvt);
+}
+
+static void SDL_TARGETING("avx2")
+RGB2YUV_RowPacked_AVX2(const Uint32 *src, Uint8 *dst, Uint32 dst_format, int width, const RGB2YUVCoefficients *cvt)
+{
+    const __m256i fy = RGB2YUV_FACTORS_AVX2(cvt->y);
+    const __m256i fu = RGB2YUV_FACTORS_AVX2(cvt->u);
+    const __m256i fv = RGB2YUV_FACTORS_AVX2(cvt->v);
+    const __m256i y_bias = _mm256_set1_epi32(cvt->y_bias);
+    const __m256i uv_bias = _mm256_set1_epi32(cvt->uv_bias);
+    int i = 0;
+
+    for (; i + 16 <= width; i += 16) {
+        RGB2YUV_StorePacked_SSE2(RGB2YUV_Y16_AVX2(&src[i], fy, y_bias),
+                                 RGB2YUV_UV8_AVX2(&src[i], &src[i], fu, fv, uv_bias), dst, dst_format);
+        dst += 32;
+    }
+    RGB2YUV_RowPacked_C(&src[i], dst, dst_format, width - i, cvt);
+}
+#endif /* HAVE_AVX2_INTRINSICS && HAVE_SSE2_INTRINSICS */
+
+static const RGB2YUVKernels RGB2YUV_kernels_C = {
+    RGB2YUV_RowY_C, RGB2YUV_RowUV_C, RGB2YUV_RowPacked_C
+};
+#if HAVE_SSE2_INTRINSICS
+static const RGB2YUVKernels RGB2YUV_kernels_SSE2 = {
+    RGB2YUV_RowY_SSE2, RGB2YUV_RowUV_SSE2, RGB2YUV_RowPacked_SSE2
+};
+#endif
+#if HAVE_AVX2_INTRINSICS && HAVE_SSE2_INTRINSICS
+static const RGB2YUVKernels RGB2YUV_kernels_AVX2 = {
+    RGB2YUV_RowY_AVX2, RGB2YUV_RowUV_AVX2, RGB2YUV_RowPacked_AVX2
+};
+#endif
+
+static const RGB2YUVKernels *
+GetRGB2YUVKernels(void)
+{
+    const RGB2YUVKernels *kernels = (const RGB2YUVKernels *)SDL_AtomicGetPtr(&RGB2YUV_kernels);
+
+    if (kernels) {
+        return kernels;
+    }
+
+    kernels = &RGB2YUV_kernels_C;
+#if HAVE_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        kernels = &RGB2YUV_kernels_SSE2;
+    }
+#endif
+#if HAVE_AVX2_INTRINSICS && HAVE_SSE2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        kernels = &RGB2YUV_kernels_AVX2;
+    }
+#endif
+    /* Every thread picks the same kernels, so it doesn't matter which one publishes first */
+    SDL_AtomicSetPtr(&RGB2YUV_kernels, (void *)kernels);
+    return kernels;
+}
+
+static int
+SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const Uint8 *curr_row = (const Uint8 *)src;
+    const RGB2YUVKernels *kernels = GetRGB2YUVKernels();
+    RGB2YUVCoefficients cvt;
+    int j;
+
+    GetRGB2YUVCoefficients(SDL_GetYUVConversionModeForResolution(width, height), &cvt);
 
     switch (dst_format) 
     {
@@ -545,135 +1090,32 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
         {
-            const Uint8 *curr_row, *next_row;
-            
+            const int uv_step = (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
             Uint8 *plane_y;
             Uint8 *plane_u;
             Uint8 *plane_v;
-            Uint8 *plane_interleaved_uv;
-            Uint32 y_stride, uv_stride, y_skip, uv_skip;
+            Uint32 y_stride, uv_stride;
 
-            GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                         (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
-                         &y_stride, &uv_stride);
-            plane_interleaved_uv = (plane_y + height * y_stride);
-            y_skip = (y_stride - width);
+            if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                             (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
+                             &y_stride, &uv_stride) < 0) {
+                return -1;
+            }
 
-            curr_row = (const Uint8*)src;
+            /* Convert two rows at a time, so the chroma is computed while they're still in cache */
+            for (j = 0; j < height; j += 2) {
+                const Uint8 *next_row = (j + 1 < height) ? (curr_row + src_pitch) : curr_row;
 
-            /* Write Y plane */
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width; i++) {
-                    const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                    const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                    const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                    const Uint32 b = (p1 & 0x000000ff);
-                    *plane_y++ = MAKE_Y(r, g, b);
+                kernels->RowY((const Uint32 *)curr_row, plane_y, width, &cvt);
+                if (next_row != curr_row) {
+                    kernels->RowY((const Uint32 *)next_row, plane_y + y_stride, width, &cvt);
                 }
-                plane_y += y_skip;
-                curr_row += src_pitch;
-            }
+                kernels->RowUV((const Uint32 *)curr_row, (const Uint32 *)next_row, plane_u, plane_v, uv_step, width, &cvt);
 
-            curr_row = (const Uint8*)src;
-            next_row = (const Uint8*)src;
-            next_row += src_pitch;
-
-            if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV)
-            {
-                /* Write UV planes, not interleaved */
-                uv_skip = (uv_stride - (width + 1)/2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_u++ = MAKE_U(r, g, b);
-                        *plane_v++ = MAKE_V(r, g, b);
-                    }
-                    plane_u += uv_skip;
-                    plane_v += uv_skip;
-                }
-            }
-            else if (dst_format == SDL_PIXELFORMAT_NV12)
-            {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    plane_interleaved_uv += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    }
-                }
-            } 
-            else /* dst_format == SDL_PIXELFORMAT_NV21 */
-            {
-                uv_skip = (uv_stride - ((width + 1)/2)*2);
-                for (j = 0; j < height_half; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_2x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_2x1_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    plane_interleaved_uv += uv_skip;
-                    curr_row += src_pitch_x_2;
-                    next_row += src_pitch_x_2;
-                }
-                if (height_remainder) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_1x2_PIXELS;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                    if (width_remainder) {
-                        READ_1x1_PIXEL;
-                        *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                        *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    }
-                }
+                plane_y += 2 * y_stride;
+                plane_u += uv_stride;
+                plane_v += uv_stride;
+                curr_row += 2 * src_pitch;
             }
         }
         break;
@@ -682,85 +1124,18 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
         {
-            const Uint8 *curr_row = (const Uint8*) src;
-            Uint8 *plane           = (Uint8*) dst;
+            Uint8 *plane = (Uint8 *)dst;
             const int row_size = (4 * ((width + 1) / 2));
-            int plane_skip;
 
             if (dst_pitch < row_size) {
                 return SDL_SetError("Destination pitch is too small, expected at least %d\n", row_size);
             }
-            plane_skip = (dst_pitch - row_size);
 
             /* Write YUV plane, packed */
-            if (dst_format == SDL_PIXELFORMAT_YUY2) 
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* Y U Y1 V */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                        *plane++ = MAKE_V(R, G, B);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* Y U Y V */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            } 
-            else if (dst_format == SDL_PIXELFORMAT_UYVY)
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* U Y V Y1 */
-                        *plane++ = MAKE_U(R, G, B);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* U Y V Y */
-                        *plane++ = MAKE_U(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
-            }
-            else if (dst_format == SDL_PIXELFORMAT_YVYU)
-            {
-                for (j = 0; j < height; j++) {
-                    for (i = 0; i < width_half; i++) {
-                        READ_TWO_RGB_PIXELS;
-                        /* Y V Y1 U */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(R, G, B);
-                        *plane++ = MAKE_Y(r1, g1, b1);
-                        *plane++ = MAKE_U(R, G, B);
-                    }
-                    if (width_remainder) {
-                        READ_ONE_RGB_PIXEL;
-                        /* Y V Y U */
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_V(r, g, b);
-                        *plane++ = MAKE_Y(r, g, b);
-                        *plane++ = MAKE_U(r, g, b);
-                    }
-                    plane += plane_skip;
-                    curr_row += src_pitch;
-                }
+            for (j = 0; j < height; j++) {
+                kernels->RowPacked((const Uint32 *)curr_row, plane, dst_format, width, &cvt);
+                plane += dst_pitch;
+                curr_row += src_pitch;
             }
         }
         break;
@@ -768,17 +1143,12 @@ SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int sr
     default:
         return SDL_SetError("Unsupported YUV destination format: %s", SDL_GetPixelFormatName(dst_format));
     }
+    return 0;
+}
+
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
-#undef READ_TWO_RGB_PIXELS
-#undef READ_ONE_RGB_PIXEL
-    return 0;
-}
 
 int
 SDL_ConvertPixels_RGB_to_YUV(int width, int height,
@@ -808,8 +1178,8 @@ SDL_ConvertPixels_RGB_to_YUV(int width, int height,
     }
 #endif
 
-    /* ARGB8888 to FOURCC */
-    if (src_format == SDL_PIXELFORMAT_ARGB8888) {
+    /* ARGB8888 to FOURCC, the alpha channel is ignored so RGB888 works too */
+    if (src_format == SDL_PIXELFORMAT_ARGB8888 || src_format == SDL_PIXELFORMAT_RGB888) {
         return SDL_ConvertPixels_ARGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch);
     }
 
@@ -0,0 +1,189 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../../SDL_internal.h"
+
+#if SDL_VIDEO_DRIVER_OFFSCREEN
+
+/* Offscreen SDL video driver implementation; windows are plain surfaces in
+ *  memory, for running render tests and benchmarks without a display.
+ *
+ * Unlike the dummy driver, the framebuffer size and format can be set with
+ *  SDL_HINT_VIDEO_OFFSCREEN_DISPLAY_SIZE and SDL_HINT_VIDEO_OFFSCREEN_FORMAT,
+ *  and presented frames are handed straight to the application through
+ *  SDL_SetWindowFrameCallback() instead of being written to disk.
+ */
+
+#include "SDL_hints.h"
+#include "SDL_video.h"
+#include "SDL_mouse.h"
+#include "../SDL_sysvideo.h"
+#include "../SDL_pixels_c.h"
+#include "../../events/SDL_events_c.h"
+
+#include "SDL_offscreenvideo.h"
+#include "SDL_offscreenevents_c.h"
+#include "SDL_offscreenframebuffer_c.h"
+
+#define OFFSCREENVID_DRIVER_NAME "offscreen"
+
+/* Initialization/Query functions */
+static int OFFSCREEN_VideoInit(_THIS);
+static int OFFSCREEN_SetDisplayMode(_THIS, SDL_VideoDisplay * display, SDL_DisplayMode * mode);
+static void OFFSCREEN_VideoQuit(_THIS);
+
+/* The framebuffer formats SDL_HINT_VIDEO_OFFSCREEN_FORMAT can ask for */
+static const Uint32 offscreen_formats[] = {
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_BGR888,
+    SDL_PIXELFORMAT_RGBX8888,
+    SDL_PIXELFORMAT_BGRX8888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGRA8888,
+    SDL_PIXELFORMAT_ARGB2101010,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_BGR24,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_BGR565,
+    SDL_PIXELFORMAT_RGB555,
+    SDL_PIXELFORMAT_BGR555,
+    SDL_PIXELFORMAT_ARGB1555,
+    SDL_PIXELFORMAT_ARGB4444
+};
+
+Uint32
+OFFSCREEN_GetFramebufferFormat(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_FORMAT);
+    const size_t prefixlen = SDL_strlen("SDL_PIXELFORMAT_");
+    int i;
+
+    if (!hint || !*hint) {
+        return SDL_PIXELFORMAT_RGB888;
+    }
+
+    /* Accept both "SDL_PIXELFORMAT_ARGB8888" and "ARGB8888" */
+    for (i = 0; i < SDL_arraysize(offscreen_formats); i++) {
+        const char *name = SDL_GetPixelFormatName(offscreen_formats[i]);
+        if (SDL_strcasecmp(hint, name) == 0 || SDL_strcasecmp(hint, name + prefixlen) == 0) {
+            return offscreen_formats[i];
+        }
+    }
+
+    SDL_SetError("Unsupported offscreen framebuffer format %s", hint);
+    return SDL_PIXELFORMAT_UNKNOWN;
+}
+
+/* OFFSCREEN driver bootstrap functions */
+
+static int
+OFFSCREEN_Available(void)
+{
+    const char *envr = SDL_getenv("SDL_VIDEODRIVER");
+    if ((envr) && (SDL_strcmp(envr, OFFSCREENVID_DRIVER_NAME) == 0)) {
+        return (1);
+    }
+
+    return (0);
+}
+
+static void
+OFFSCREEN_DeleteDevice(SDL_VideoDevice * device)
+{
+    SDL_free(device);
+}
+
+static SDL_VideoDevice *
+OFFSCREEN_CreateDevice(int devindex)
+{
+    SDL_VideoDevice *device;
+
+    /* Initialize all variables that we clean on shutdown */
+    device = (SDL_VideoDevice *) SDL_calloc(1, sizeof(SDL_VideoDevice));
+    if (!device) {
+        SDL_OutOfMemory();
+        return (0);
+    }
+
+    /* Set the function pointers */
+    device->VideoInit = OFFSCREEN_VideoInit;
+    device->VideoQuit = OFFSCREEN_VideoQuit;
+    device->SetDisplayMode = OFFSCREEN_SetDisplayMode;
+    device->PumpEvents = OFFSCREEN_PumpEvents;
+    device->CreateWindowFramebuffer = SDL_OFFSCREEN_CreateWindowFramebuffer;
+    device->UpdateWindowFramebuffer = SDL_OFFSCREEN_UpdateWindowFramebuffer;
+    device->DestroyWindowFramebuffer = SDL_OFFSCREEN_DestroyWindowFramebuffer;
+
+    device->free = OFFSCREEN_DeleteDevice;
+
+    return device;
+}
+
+VideoBootStrap OFFSCREEN_bootstrap = {
+    OFFSCREENVID_DRIVER_NAME, "SDL offscreen video driver",
+    OFFSCREEN_Available, OFFSCREEN_CreateDevice
+};
+
+
+int
+OFFSCREEN_VideoInit(_THIS)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_DISPLAY_SIZE);
+    SDL_DisplayMode mode;
+
+    mode.format = OFFSCREEN_GetFramebufferFormat();
+    if (mode.format == SDL_PIXELFORMAT_UNKNOWN) {
+        return -1;
+    }
+    mode.w = 1024;
+    mode.h = 768;
+    if (hint && *hint) {
+        if (SDL_sscanf(hint, "%dx%d", &mode.w, &mode.h) != 2 || mode.w <= 0 || mode.h <= 0) {
+            return SDL_SetError("Invalid offscreen display size %s", hint);
+        }
+    }
+    mode.refresh_rate = 0;
+    mode.driverdata = NULL;
+    if (SDL_AddBasicVideoDisplay(&mode) < 0) {
+        return -1;
+    }
+
+    SDL_AddDisplayMode(&_this->displays[0], &mode);
+
+    /* We're done! */
+    return 0;
+}
+
+static int
+OFFSCREEN_SetDisplayMode(_THIS, SDL_VideoDisplay * display, SDL_DisplayMode * mode)
+{
+    return 0;
+}
+
+void
+OFFSCREEN_VideoQuit(_THIS)
+{
+}
+
+#endif /* SDL_VIDEO_DRIVER_OFFSCREEN */
+
+/* vi: set ts=4 sw=4 expandtab: */
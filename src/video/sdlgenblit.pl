@@ -85,6 +85,553 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = ((Uint32)_B << 24) | ((Uint32)_G << 16) | ((Uint32)_R << 8) | _A;",
 );
 
+# SIMD versions of the blitters above, selected at runtime through the CPU
+# flags in the blit table.  The per-combination functions all expand a common
+# kernel with constant formats and flags, and do the same integer math as the
+# C versions, x / 255 included, so they give identical results.
+my @simd_isas = (
+    "AVX2",
+    "SSE2",
+    "NEON",
+);
+
+my %simd_target = (
+    "AVX2" => "avx2",
+    "SSE2" => "",
+    "NEON" => "",
+);
+
+my $simd_common = <<'__EOF__';
+#if HAVE_AVX2_INTRINSICS || HAVE_SSE2_INTRINSICS || HAVE_NEON_INTRINSICS
+/* Channel multipliers for one ARGB8888 pixel in B, G, R, A order, 255 leaves a channel alone */
+static void SDL_Blit_Auto_GetModulate(const SDL_BlitInfo *info, Uint16 modulate[4])
+{
+    const int flags = info->flags;
+    modulate[0] = (flags & SDL_COPY_MODULATE_COLOR) ? info->b : 255;
+    modulate[1] = (flags & SDL_COPY_MODULATE_COLOR) ? info->g : 255;
+    modulate[2] = (flags & SDL_COPY_MODULATE_COLOR) ? info->r : 255;
+    modulate[3] = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+}
+#endif
+
+__EOF__
+
+my %simd_kernel;
+
+$simd_kernel{"SSE2"} = <<'__EOF__';
+/* x / 255 for 0 <= x <= 65535, exactly */
+#define SDL_BLIT_AUTO_DIV255_SSE2(x) _mm_srli_epi16(_mm_mulhi_epu16(x, _mm_set1_epi16((short)0x8081)), 7)
+
+SDL_FORCE_INLINE __m128i SDL_Blit_Auto_SwapRB_SSE2(__m128i v)
+{
+    return _mm_or_si128(_mm_and_si128(v, _mm_set1_epi32(0xFF00FF00)),
+                        _mm_or_si128(_mm_and_si128(_mm_srli_epi32(v, 16), _mm_set1_epi32(0xFF)),
+                                     _mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(0xFF)), 16)));
+}
+
+SDL_FORCE_INLINE __m128i SDL_Blit_Auto_Swap32_SSE2(__m128i v)
+{
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(v, 24), _mm_srli_epi32(v, 24)),
+                        _mm_or_si128(_mm_and_si128(_mm_slli_epi32(v, 8), _mm_set1_epi32(0x00FF0000)),
+                                     _mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0x0000FF00))));
+}
+
+/* Formats without alpha read as opaque */
+SDL_FORCE_INLINE __m128i SDL_Blit_Auto_ToARGB_SSE2(__m128i v, Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB888:
+        return _mm_or_si128(v, _mm_set1_epi32(0xFF000000));
+    case SDL_PIXELFORMAT_BGR888:
+        return _mm_or_si128(SDL_Blit_Auto_SwapRB_SSE2(v), _mm_set1_epi32(0xFF000000));
+    case SDL_PIXELFORMAT_RGBA8888:
+        return _mm_or_si128(_mm_srli_epi32(v, 8), _mm_slli_epi32(v, 24));
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_Blit_Auto_SwapRB_SSE2(v);
+    case SDL_PIXELFORMAT_BGRA8888:
+        return SDL_Blit_Auto_Swap32_SSE2(v);
+    default:
+        return v;
+    }
+}
+
+/* Formats without alpha are written with the unused byte cleared */
+SDL_FORCE_INLINE __m128i SDL_Blit_Auto_FromARGB_SSE2(__m128i v, Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB888:
+        return _mm_and_si128(v, _mm_set1_epi32(0x00FFFFFF));
+    case SDL_PIXELFORMAT_BGR888:
+        return _mm_and_si128(SDL_Blit_Auto_SwapRB_SSE2(v), _mm_set1_epi32(0x00FFFFFF));
+    case SDL_PIXELFORMAT_RGBA8888:
+        return _mm_or_si128(_mm_slli_epi32(v, 8), _mm_srli_epi32(v, 24));
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_Blit_Auto_SwapRB_SSE2(v);
+    case SDL_PIXELFORMAT_BGRA8888:
+        return SDL_Blit_Auto_Swap32_SSE2(v);
+    default:
+        return v;
+    }
+}
+
+/* Modulate and blend four ARGB8888 pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE __m128i SDL_Blit_Auto_Pixels_SSE2(__m128i src, __m128i dst, int flags, int modulate, int blend, __m128i modulate16)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i amask = _mm_set1_epi32(0xFF000000);
+    __m128i srclo = _mm_unpacklo_epi8(src, zero);
+    __m128i srchi = _mm_unpackhi_epi8(src, zero);
+    __m128i dstlo, dsthi, alphalo, alphahi;
+
+    if (modulate) {
+        srclo = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srclo, modulate16));
+        srchi = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srchi, modulate16));
+        if (blend && (flags & SDL_COPY_BLEND_PREMULTIPLIED) && (flags & SDL_COPY_MODULATE_ALPHA)) {
+            /* Premultiplied color is scaled along with the alpha */
+            const __m128i keepalpha = _mm_setr_epi16(0, 0, 0, 0xFF, 0, 0, 0, 0xFF);
+            const __m128i alphamod = _mm_or_si128(_mm_shufflehi_epi16(_mm_shufflelo_epi16(modulate16, 0xFF), 0xFF), keepalpha);
+            srclo = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srclo, alphamod));
+            srchi = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srchi, alphamod));
+        }
+    }
+    if (!blend) {
+        return _mm_packus_epi16(srclo, srchi);
+    }
+
+    alphalo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srclo, 0xFF), 0xFF);
+    alphahi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(srchi, 0xFF), 0xFF);
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        const __m128i keepalpha = _mm_setr_epi16(0, 0, 0, 0xFF, 0, 0, 0, 0xFF);
+        srclo = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srclo, _mm_or_si128(alphalo, keepalpha)));
+        srchi = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srchi, _mm_or_si128(alphahi, keepalpha)));
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_BLEND_PREMULTIPLIED|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        dstlo = _mm_unpacklo_epi8(dst, zero);
+        dsthi = _mm_unpackhi_epi8(dst, zero);
+        dstlo = _mm_add_epi16(srclo, SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(0xFF), alphalo), dstlo)));
+        dsthi = _mm_add_epi16(srchi, SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(_mm_sub_epi16(_mm_set1_epi16(0xFF), alphahi), dsthi)));
+        return _mm_packus_epi16(dstlo, dsthi);
+    case SDL_COPY_ADD:
+        src = _mm_adds_epu8(_mm_packus_epi16(srclo, srchi), dst);
+        return _mm_or_si128(_mm_andnot_si128(amask, src), _mm_and_si128(amask, dst));
+    case SDL_COPY_MOD:
+        dstlo = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srclo, _mm_unpacklo_epi8(dst, zero)));
+        dsthi = SDL_BLIT_AUTO_DIV255_SSE2(_mm_mullo_epi16(srchi, _mm_unpackhi_epi8(dst, zero)));
+        return _mm_or_si128(_mm_andnot_si128(amask, _mm_packus_epi16(dstlo, dsthi)), _mm_and_si128(amask, dst));
+    default:
+        return dst;
+    }
+}
+
+SDL_FORCE_INLINE void SDL_Blit_Auto_SSE2(SDL_BlitInfo *info, Uint32 src_format, Uint32 dst_format, int modulate, int blend, int scale)
+{
+    const int flags = info->flags;
+    Uint16 m[4];
+    Uint32 buffer[8];
+    __m128i modulate16;
+    int posy = 0;
+    int incy = 0, incx = 0;
+
+    SDL_Blit_Auto_GetModulate(info, m);
+    modulate16 = _mm_setr_epi16(m[0], m[1], m[2], m[3], m[0], m[1], m[2], m[3]);
+    SDL_zero(buffer);
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? info->src + (posy >> 16) * info->src_pitch : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int posx = 0;
+
+        while (n > 0) {
+            /* The last few pixels of a row go through a small buffer */
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? buffer + 4 : dst;
+            __m128i pixels, dstpixels = _mm_setzero_si128();
+            int i;
+
+            if (count < 4 || scale) {
+                for (i = 0; i < count; ++i) {
+                    buffer[i] = scale ? src[(posx + i * incx) >> 16] : src[i];
+                    buffer[4 + i] = dst[i];
+                }
+                pixels = _mm_loadu_si128((const __m128i *)buffer);
+            } else {
+                pixels = _mm_loadu_si128((const __m128i *)src);
+            }
+            if (blend) {
+                dstpixels = SDL_Blit_Auto_ToARGB_SSE2(_mm_loadu_si128((const __m128i *)d), dst_format);
+            }
+            pixels = SDL_Blit_Auto_Pixels_SSE2(SDL_Blit_Auto_ToARGB_SSE2(pixels, src_format), dstpixels, flags, modulate, blend, modulate16);
+            _mm_storeu_si128((__m128i *)d, SDL_Blit_Auto_FromARGB_SSE2(pixels, dst_format));
+            if (d != dst) {
+                SDL_memcpy(dst, d, count * sizeof (Uint32));
+            }
+            if (scale) {
+                posx += count * incx;
+            } else {
+                src += count;
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+
+$simd_kernel{"AVX2"} = <<'__EOF__';
+/* x / 255 for 0 <= x <= 65535, exactly */
+#define SDL_BLIT_AUTO_DIV255_AVX2(x) _mm256_srli_epi16(_mm256_mulhi_epu16(x, _mm256_set1_epi16((short)0x8081)), 7)
+
+/* Reorder the bytes of each pixel, byte i of the result is byte bi of the source */
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Auto_Shuffle_AVX2(__m256i v, char b0, char b1, char b2, char b3)
+{
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(
+        b0, b1, b2, b3, b0 + 4, b1 + 4, b2 + 4, b3 + 4, b0 + 8, b1 + 8, b2 + 8, b3 + 8, b0 + 12, b1 + 12, b2 + 12, b3 + 12,
+        b0, b1, b2, b3, b0 + 4, b1 + 4, b2 + 4, b3 + 4, b0 + 8, b1 + 8, b2 + 8, b3 + 8, b0 + 12, b1 + 12, b2 + 12, b3 + 12));
+}
+
+/* Formats without alpha read as opaque */
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Auto_ToARGB_AVX2(__m256i v, Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB888:
+        return _mm256_or_si256(v, _mm256_set1_epi32(0xFF000000));
+    case SDL_PIXELFORMAT_BGR888:
+        return _mm256_or_si256(SDL_Blit_Auto_Shuffle_AVX2(v, 2, 1, 0, 3), _mm256_set1_epi32(0xFF000000));
+    case SDL_PIXELFORMAT_RGBA8888:
+        return SDL_Blit_Auto_Shuffle_AVX2(v, 1, 2, 3, 0);
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_Blit_Auto_Shuffle_AVX2(v, 2, 1, 0, 3);
+    case SDL_PIXELFORMAT_BGRA8888:
+        return SDL_Blit_Auto_Shuffle_AVX2(v, 3, 2, 1, 0);
+    default:
+        return v;
+    }
+}
+
+/* Formats without alpha are written with the unused byte cleared */
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Auto_FromARGB_AVX2(__m256i v, Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB888:
+        return _mm256_and_si256(v, _mm256_set1_epi32(0x00FFFFFF));
+    case SDL_PIXELFORMAT_BGR888:
+        return _mm256_and_si256(SDL_Blit_Auto_Shuffle_AVX2(v, 2, 1, 0, 3), _mm256_set1_epi32(0x00FFFFFF));
+    case SDL_PIXELFORMAT_RGBA8888:
+        return SDL_Blit_Auto_Shuffle_AVX2(v, 3, 0, 1, 2);
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_Blit_Auto_Shuffle_AVX2(v, 2, 1, 0, 3);
+    case SDL_PIXELFORMAT_BGRA8888:
+        return SDL_Blit_Auto_Shuffle_AVX2(v, 3, 2, 1, 0);
+    default:
+        return v;
+    }
+}
+
+/* Modulate and blend eight ARGB8888 pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Auto_Pixels_AVX2(__m256i src, __m256i dst, int flags, int modulate, int blend, __m256i modulate16)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i amask = _mm256_set1_epi32(0xFF000000);
+    __m256i srclo = _mm256_unpacklo_epi8(src, zero);
+    __m256i srchi = _mm256_unpackhi_epi8(src, zero);
+    __m256i dstlo, dsthi, alphalo, alphahi;
+
+    if (modulate) {
+        srclo = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srclo, modulate16));
+        srchi = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srchi, modulate16));
+        if (blend && (flags & SDL_COPY_BLEND_PREMULTIPLIED) && (flags & SDL_COPY_MODULATE_ALPHA)) {
+            /* Premultiplied color is scaled along with the alpha */
+            const __m256i keepalpha = _mm256_set1_epi64x(0x00FF000000000000LL);
+            const __m256i alphamod = _mm256_or_si256(_mm256_shufflehi_epi16(_mm256_shufflelo_epi16(modulate16, 0xFF), 0xFF), keepalpha);
+            srclo = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srclo, alphamod));
+            srchi = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srchi, alphamod));
+        }
+    }
+    if (!blend) {
+        return _mm256_packus_epi16(srclo, srchi);
+    }
+
+    alphalo = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(srclo, 0xFF), 0xFF);
+    alphahi = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(srchi, 0xFF), 0xFF);
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        const __m256i keepalpha = _mm256_set1_epi64x(0x00FF000000000000LL);
+        srclo = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srclo, _mm256_or_si256(alphalo, keepalpha)));
+        srchi = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srchi, _mm256_or_si256(alphahi, keepalpha)));
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_BLEND_PREMULTIPLIED|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        dstlo = _mm256_unpacklo_epi8(dst, zero);
+        dsthi = _mm256_unpackhi_epi8(dst, zero);
+        dstlo = _mm256_add_epi16(srclo, SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_set1_epi16(0xFF), alphalo), dstlo)));
+        dsthi = _mm256_add_epi16(srchi, SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_set1_epi16(0xFF), alphahi), dsthi)));
+        return _mm256_packus_epi16(dstlo, dsthi);
+    case SDL_COPY_ADD:
+        src = _mm256_adds_epu8(_mm256_packus_epi16(srclo, srchi), dst);
+        return _mm256_blendv_epi8(src, dst, amask);
+    case SDL_COPY_MOD:
+        dstlo = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srclo, _mm256_unpacklo_epi8(dst, zero)));
+        dsthi = SDL_BLIT_AUTO_DIV255_AVX2(_mm256_mullo_epi16(srchi, _mm256_unpackhi_epi8(dst, zero)));
+        return _mm256_blendv_epi8(_mm256_packus_epi16(dstlo, dsthi), dst, amask);
+    default:
+        return dst;
+    }
+}
+
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") SDL_Blit_Auto_AVX2(SDL_BlitInfo *info, Uint32 src_format, Uint32 dst_format, int modulate, int blend, int scale)
+{
+    const int flags = info->flags;
+    Uint16 m[4];
+    Uint32 buffer[16];
+    __m256i modulate16, stepx = _mm256_setzero_si256();
+    int posy = 0;
+    int incy = 0, incx = 0;
+
+    SDL_Blit_Auto_GetModulate(info, m);
+    modulate16 = _mm256_set1_epi64x((Sint64)m[0] | ((Sint64)m[1] << 16) | ((Sint64)m[2] << 32) | ((Sint64)m[3] << 48));
+    SDL_zero(buffer);
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+        stepx = _mm256_mullo_epi32(_mm256_set1_epi32(incx), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? info->src + (posy >> 16) * info->src_pitch : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int posx = 0;
+
+        while (n > 0) {
+            /* The last few pixels of a row go through a small buffer */
+            const int count = SDL_min(n, 8);
+            Uint32 *d = (count < 8) ? buffer + 8 : dst;
+            __m256i pixels, dstpixels = _mm256_setzero_si256();
+            int i;
+
+            if (count < 8) {
+                for (i = 0; i < count; ++i) {
+                    buffer[i] = scale ? src[(posx + i * incx) >> 16] : src[i];
+                    buffer[8 + i] = dst[i];
+                }
+                pixels = _mm256_loadu_si256((const __m256i *)buffer);
+            } else if (scale) {
+                const __m256i srcx = _mm256_srli_epi32(_mm256_add_epi32(_mm256_set1_epi32(posx), stepx), 16);
+                pixels = _mm256_i32gather_epi32((const int *)src, srcx, 4);
+            } else {
+                pixels = _mm256_loadu_si256((const __m256i *)src);
+            }
+            if (blend) {
+                dstpixels = SDL_Blit_Auto_ToARGB_AVX2(_mm256_loadu_si256((const __m256i *)d), dst_format);
+            }
+            pixels = SDL_Blit_Auto_Pixels_AVX2(SDL_Blit_Auto_ToARGB_AVX2(pixels, src_format), dstpixels, flags, modulate, blend, modulate16);
+            _mm256_storeu_si256((__m256i *)d, SDL_Blit_Auto_FromARGB_AVX2(pixels, dst_format));
+            if (d != dst) {
+                SDL_memcpy(dst, d, count * sizeof (Uint32));
+            }
+            if (scale) {
+                posx += count * incx;
+            } else {
+                src += count;
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+
+$simd_kernel{"NEON"} = <<'__EOF__';
+/* x / 255 for 0 <= x <= 65025, exactly */
+#define SDL_BLIT_AUTO_DIV255_NEON(x) vshrq_n_u16(vaddq_u16(vaddq_u16(x, vdupq_n_u16(1)), vshrq_n_u16(x, 8)), 8)
+
+SDL_FORCE_INLINE uint32x4_t SDL_Blit_Auto_SwapRB_NEON(uint32x4_t v)
+{
+    return vorrq_u32(vandq_u32(v, vdupq_n_u32(0xFF00FF00)),
+                     vorrq_u32(vandq_u32(vshrq_n_u32(v, 16), vdupq_n_u32(0xFF)),
+                               vshlq_n_u32(vandq_u32(v, vdupq_n_u32(0xFF)), 16)));
+}
+
+/* Formats without alpha read as opaque */
+SDL_FORCE_INLINE uint32x4_t SDL_Blit_Auto_ToARGB_NEON(uint32x4_t v, Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB888:
+        return vorrq_u32(v, vdupq_n_u32(0xFF000000));
+    case SDL_PIXELFORMAT_BGR888:
+        return vorrq_u32(SDL_Blit_Auto_SwapRB_NEON(v), vdupq_n_u32(0xFF000000));
+    case SDL_PIXELFORMAT_RGBA8888:
+        return vorrq_u32(vshrq_n_u32(v, 8), vshlq_n_u32(v, 24));
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_Blit_Auto_SwapRB_NEON(v);
+    case SDL_PIXELFORMAT_BGRA8888:
+        return vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(v)));
+    default:
+        return v;
+    }
+}
+
+/* Formats without alpha are written with the unused byte cleared */
+SDL_FORCE_INLINE uint32x4_t SDL_Blit_Auto_FromARGB_NEON(uint32x4_t v, Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_RGB888:
+        return vandq_u32(v, vdupq_n_u32(0x00FFFFFF));
+    case SDL_PIXELFORMAT_BGR888:
+        return vandq_u32(SDL_Blit_Auto_SwapRB_NEON(v), vdupq_n_u32(0x00FFFFFF));
+    case SDL_PIXELFORMAT_RGBA8888:
+        return vorrq_u32(vshlq_n_u32(v, 8), vshrq_n_u32(v, 24));
+    case SDL_PIXELFORMAT_ABGR8888:
+        return SDL_Blit_Auto_SwapRB_NEON(v);
+    case SDL_PIXELFORMAT_BGRA8888:
+        return vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(v)));
+    default:
+        return v;
+    }
+}
+
+/* Modulate and blend four ARGB8888 pixels, one channel per 16-bit lane */
+SDL_FORCE_INLINE uint32x4_t SDL_Blit_Auto_Pixels_NEON(uint32x4_t src, uint32x4_t dst, int flags, int modulate, int blend, uint16x8_t modulate16)
+{
+    const uint32x4_t amask = vdupq_n_u32(0xFF000000);
+    uint8x16_t src8 = vreinterpretq_u8_u32(src);
+    uint16x8_t srclo = vmovl_u8(vget_low_u8(src8));
+    uint16x8_t srchi = vmovl_u8(vget_high_u8(src8));
+    uint16x8_t dstlo, dsthi, alphalo, alphahi;
+    uint8x16_t alpha8;
+
+    if (modulate) {
+        srclo = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srclo, modulate16));
+        srchi = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srchi, modulate16));
+        if (blend && (flags & SDL_COPY_BLEND_PREMULTIPLIED) && (flags & SDL_COPY_MODULATE_ALPHA)) {
+            /* Premultiplied color is scaled along with the alpha */
+            const uint16x8_t keepalpha = vreinterpretq_u16_u64(vdupq_n_u64(0x00FF000000000000ULL));
+            const uint16x8_t alphamod = vorrq_u16(vdupq_n_u16(vgetq_lane_u16(modulate16, 3)), keepalpha);
+            srclo = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srclo, alphamod));
+            srchi = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srchi, alphamod));
+        }
+        src8 = vcombine_u8(vqmovn_u16(srclo), vqmovn_u16(srchi));
+    }
+    if (!blend) {
+        return vreinterpretq_u32_u8(src8);
+    }
+
+    /* Every byte of a pixel set to its alpha */
+    alpha8 = vreinterpretq_u8_u32(vmulq_n_u32(vshrq_n_u32(vreinterpretq_u32_u8(src8), 24), 0x01010101));
+    alphalo = vmovl_u8(vget_low_u8(alpha8));
+    alphahi = vmovl_u8(vget_high_u8(alpha8));
+    if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+        const uint8x16_t premultiply = vorrq_u8(alpha8, vreinterpretq_u8_u32(amask));
+        srclo = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srclo, vmovl_u8(vget_low_u8(premultiply))));
+        srchi = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srchi, vmovl_u8(vget_high_u8(premultiply))));
+    }
+    switch (flags & (SDL_COPY_BLEND|SDL_COPY_BLEND_PREMULTIPLIED|SDL_COPY_ADD|SDL_COPY_MOD)) {
+    case SDL_COPY_BLEND:
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        dstlo = vmovl_u8(vget_low_u8(vreinterpretq_u8_u32(dst)));
+        dsthi = vmovl_u8(vget_high_u8(vreinterpretq_u8_u32(dst)));
+        dstlo = vaddq_u16(srclo, SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(vsubq_u16(vdupq_n_u16(0xFF), alphalo), dstlo)));
+        dsthi = vaddq_u16(srchi, SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(vsubq_u16(vdupq_n_u16(0xFF), alphahi), dsthi)));
+        return vreinterpretq_u32_u8(vcombine_u8(vqmovn_u16(dstlo), vqmovn_u16(dsthi)));
+    case SDL_COPY_ADD:
+        src8 = vqaddq_u8(vcombine_u8(vqmovn_u16(srclo), vqmovn_u16(srchi)), vreinterpretq_u8_u32(dst));
+        return vbslq_u32(amask, dst, vreinterpretq_u32_u8(src8));
+    case SDL_COPY_MOD:
+        dstlo = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srclo, vmovl_u8(vget_low_u8(vreinterpretq_u8_u32(dst)))));
+        dsthi = SDL_BLIT_AUTO_DIV255_NEON(vmulq_u16(srchi, vmovl_u8(vget_high_u8(vreinterpretq_u8_u32(dst)))));
+        return vbslq_u32(amask, dst, vreinterpretq_u32_u8(vcombine_u8(vqmovn_u16(dstlo), vqmovn_u16(dsthi))));
+    default:
+        return dst;
+    }
+}
+
+SDL_FORCE_INLINE void SDL_Blit_Auto_NEON(SDL_BlitInfo *info, Uint32 src_format, Uint32 dst_format, int modulate, int blend, int scale)
+{
+    const int flags = info->flags;
+    Uint16 m[4];
+    Uint32 buffer[8];
+    uint16x8_t modulate16;
+    int posy = 0;
+    int incy = 0, incx = 0;
+
+    SDL_Blit_Auto_GetModulate(info, m);
+    modulate16 = vcombine_u16(vld1_u16(m), vld1_u16(m));
+    SDL_zero(buffer);
+    if (scale) {
+        incy = (info->src_h << 16) / info->dst_h;
+        incx = (info->src_w << 16) / info->dst_w;
+    }
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)(scale ? info->src + (posy >> 16) * info->src_pitch : info->src);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int posx = 0;
+
+        while (n > 0) {
+            /* The last few pixels of a row go through a small buffer */
+            const int count = SDL_min(n, 4);
+            Uint32 *d = (count < 4) ? buffer + 4 : dst;
+            uint32x4_t pixels, dstpixels = vdupq_n_u32(0);
+            int i;
+
+            if (count < 4 || scale) {
+                for (i = 0; i < count; ++i) {
+                    buffer[i] = scale ? src[(posx + i * incx) >> 16] : src[i];
+                    buffer[4 + i] = dst[i];
+                }
+                pixels = vld1q_u32(buffer);
+            } else {
+                pixels = vld1q_u32(src);
+            }
+            if (blend) {
+                dstpixels = SDL_Blit_Auto_ToARGB_NEON(vld1q_u32(d), dst_format);
+            }
+            pixels = SDL_Blit_Auto_Pixels_NEON(SDL_Blit_Auto_ToARGB_NEON(pixels, src_format), dstpixels, flags, modulate, blend, modulate16);
+            vst1q_u32(d, SDL_Blit_Auto_FromARGB_NEON(pixels, dst_format));
+            if (d != dst) {
+                SDL_memcpy(dst, d, count * sizeof (Uint32));
+            }
+            if (scale) {
+                posx += count * incx;
+            } else {
+                src += count;
+            }
+            dst += count;
+            n -= count;
+        }
+        if (scale) {
+            posy += incy;
+        } else {
+            info->src += info->src_pitch;
+        }
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -147,6 +694,7 @@ sub output_copyfuncname
     my $modulate = shift;
     my $blend = shift;
     my $scale = shift;
+    my $isa = shift;
     my $args = shift;
     my $suffix = shift;
 
@@ -160,6 +708,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( $isa ne "" ) {
+        print FILE "_$isa";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -243,7 +794,19 @@ __EOF__
                 ${s}B = (${s}B * modulateB) / 255;
             }
 __EOF__
-        if (not $ignore_dst_alpha) {
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                ${s}A = (${s}A * modulateA) / 255;
+                if (flags & SDL_COPY_BLEND_PREMULTIPLIED) {
+                    /* The color is scaled by alpha along with the alpha */
+                    ${s}R = (${s}R * modulateA) / 255;
+                    ${s}G = (${s}G * modulateA) / 255;
+                    ${s}B = (${s}B * modulateA) / 255;
+                }
+            }
+__EOF__
+        } elsif (not $ignore_dst_alpha) {
             print FILE <<__EOF__;
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 ${s}A = (${s}A * modulateA) / 255;
@@ -261,7 +824,7 @@ __EOF__
                     ${s}B = (${s}B * ${s}A) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD)) {
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_BLEND_PREMULTIPLIED|SDL_COPY_ADD|SDL_COPY_MOD)) {
             case SDL_COPY_BLEND:
                 ${d}R = ${s}R + ((255 - ${s}A) * ${d}R) / 255;
                 ${d}G = ${s}G + ((255 - ${s}A) * ${d}G) / 255;
@@ -274,6 +837,20 @@ __EOF__
 __EOF__
         }
 
+        print FILE <<__EOF__;
+                break;
+            case SDL_COPY_BLEND_PREMULTIPLIED:
+                ${d}R = ${s}R + ((255 - ${s}A) * ${d}R) / 255; if (${d}R > 255) ${d}R = 255;
+                ${d}G = ${s}G + ((255 - ${s}A) * ${d}G) / 255; if (${d}G > 255) ${d}G = 255;
+                ${d}B = ${s}B + ((255 - ${s}A) * ${d}B) / 255; if (${d}B > 255) ${d}B = 255;
+__EOF__
+
+        if ( $dst_has_alpha ) {
+            print FILE <<__EOF__;
+                ${d}A = ${s}A + ((255 - ${s}A) * ${d}A) / 255;
+__EOF__
+        }
+
         print FILE <<__EOF__;
                 break;
             case SDL_COPY_ADD:
@@ -307,7 +884,7 @@ sub output_copyfunc
     my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
     my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
 
-    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, 1, "\n");
+    output_copyfuncname("static void", $src, $dst, $modulate, $blend, $scale, "", 1, "\n");
     print FILE <<__EOF__;
 {
 __EOF__
@@ -440,56 +1017,59 @@ sub output_copyinc
 __EOF__
 }
 
+sub get_copyflags
+{
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my @flags = ();
+
+    if ( $modulate ) {
+        push(@flags, "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA");
+    }
+    if ( $blend ) {
+        push(@flags, "SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_ADD | SDL_COPY_MOD");
+    }
+    if ( $scale ) {
+        push(@flags, "SDL_COPY_NEAREST");
+    }
+    if ( !@flags ) {
+        return "0";
+    }
+    return join(" | ", @flags);
+}
+
 sub output_copyfunctable
 {
     print FILE <<__EOF__;
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
 __EOF__
-    for (my $i = 0; $i <= $#src_formats; ++$i) {
-        my $src = $src_formats[$i];
-        for (my $j = 0; $j <= $#dst_formats; ++$j) {
-            my $dst = $dst_formats[$j];
-            for (my $modulate = 0; $modulate <= 1; ++$modulate) {
-                for (my $blend = 0; $blend <= 1; ++$blend) {
-                    for (my $scale = 0; $scale <= 1; ++$scale) {
-                        if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
-                            my $flags = "";
-                            my $flag = "";
-                            if ( $modulate ) {
-                                $flag = "SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $blend ) {
-                                $flag = "SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $scale ) {
-                                $flag = "SDL_COPY_NEAREST";
-                                if ( $flags eq "" ) {
-                                    $flags = $flag;
-                                } else {
-                                    $flags = "$flags | $flag";
-                                }
-                            }
-                            if ( $flags eq "" ) {
-                                $flags = "0";
+    # The SIMD versions come first so SDL_ChooseBlitFunc() prefers them
+    foreach my $isa (@simd_isas, "") {
+        my $cpu = ($isa eq "") ? "SDL_CPU_ANY" : "SDL_CPU_$isa";
+        if ( $isa ne "" ) {
+            print FILE "#if HAVE_${isa}_INTRINSICS\n";
+        }
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            my $src = $src_formats[$i];
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                my $dst = $dst_formats[$j];
+                for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+                    for (my $blend = 0; $blend <= 1; ++$blend) {
+                        for (my $scale = 0; $scale <= 1; ++$scale) {
+                            if ( $modulate || $blend || $scale ) {
+                                my $flags = get_copyflags($modulate, $blend, $scale);
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $cpu,";
+                                output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, $isa, 0, " },\n");
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
                     }
                 }
             }
         }
+        if ( $isa ne "" ) {
+            print FILE "#endif /* HAVE_${isa}_INTRINSICS */\n";
+        }
     }
     print FILE <<__EOF__;
     { 0, 0, 0, 0, NULL }
@@ -514,6 +1094,48 @@ sub output_copyfunc_c
     }
 }
 
+sub output_copyfunc_simd
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            for (my $scale = 0; $scale <= 1; ++$scale) {
+                if ( $modulate || $blend || $scale ) {
+                    my $prefix = "static void";
+                    if ( $simd_target{$isa} ne "" ) {
+                        $prefix = "$prefix SDL_TARGETING(\"$simd_target{$isa}\")";
+                    }
+                    output_copyfuncname($prefix, $src, $dst, $modulate, $blend, $scale, $isa, 1, "\n");
+                    print FILE <<__EOF__;
+{
+    SDL_Blit_Auto_$isa(info, SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, $modulate, $blend, $scale);
+}
+
+__EOF__
+                }
+            }
+        }
+    }
+}
+
+sub output_simd_c
+{
+    print FILE $simd_common;
+    foreach my $isa (@simd_isas) {
+        print FILE "#if HAVE_${isa}_INTRINSICS\n";
+        print FILE $simd_kernel{$isa};
+        for (my $i = 0; $i <= $#src_formats; ++$i) {
+            for (my $j = 0; $j <= $#dst_formats; ++$j) {
+                output_copyfunc_simd($isa, $src_formats[$i], $dst_formats[$j]);
+            }
+        }
+        print FILE "#endif /* HAVE_${isa}_INTRINSICS */\n\n";
+    }
+}
+
 open_file("SDL_blit_auto.h");
 output_copydefs();
 for (my $i = 0; $i <= $#src_formats; ++$i) {
@@ -531,5 +1153,6 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simd_c();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
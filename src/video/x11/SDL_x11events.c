@@ -31,6 +31,7 @@
 #include "SDL_x11video.h"
 #include "SDL_x11touch.h"
 #include "SDL_x11xinput2.h"
+#include "SDL_x11framebuffer.h"
 #include "../../core/unix/SDL_poll.h"
 #include "../../events/SDL_events_c.h"
 #include "../../events/SDL_mouse_c.h"
@@ -701,6 +702,15 @@ X11_DispatchEvent(_THIS)
     }
 #endif
 
+#ifndef NO_SHARED_MEMORY
+    /* Completions of window surface updates, see X11_UpdateWindowFramebuffer() */
+    if (videodata->shm_completion_event &&
+        xevent.type == videodata->shm_completion_event) {
+        X11_HandleShmCompletion(videodata, &xevent);
+        return;
+    }
+#endif
+
 #if 0
     printf("type = %d display = %d window = %d\n",
            xevent.type, xevent.xany.display, xevent.xany.window);
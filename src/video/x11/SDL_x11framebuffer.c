@@ -24,6 +24,7 @@
 
 #include "SDL_x11video.h"
 #include "SDL_x11framebuffer.h"
+#include "SDL_hints.h"
 
 
 #ifndef NO_SHARED_MEMORY
@@ -50,6 +51,138 @@ static SDL_bool have_mitshm(void)
     return SDL_FALSE;
 }
 
+static SDL_bool
+X11_CreateShmBuffer(Display *display, Visual *visual, int depth,
+                    int w, int h, int size, X11_ShmBuffer *buffer)
+{
+    XShmSegmentInfo *shminfo = &buffer->shminfo;
+
+    shminfo->shmid = shmget(IPC_PRIVATE, size, IPC_CREAT | 0777);
+    if ( shminfo->shmid >= 0 ) {
+        shminfo->shmaddr = (char *)shmat(shminfo->shmid, 0, 0);
+        shminfo->readOnly = False;
+        if ( shminfo->shmaddr != (char *)-1 ) {
+            shm_error = False;
+            X_handler = X11_XSetErrorHandler(shm_errhandler);
+            X11_XShmAttach(display, shminfo);
+            X11_XSync(display, False);
+            X11_XSetErrorHandler(X_handler);
+            if ( shm_error )
+                shmdt(shminfo->shmaddr);
+        } else {
+            shm_error = True;
+        }
+        shmctl(shminfo->shmid, IPC_RMID, NULL);
+    } else {
+        shm_error = True;
+    }
+    if (shm_error) {
+        return SDL_FALSE;
+    }
+
+    buffer->ximage = X11_XShmCreateImage(display, visual,
+                         depth, ZPixmap,
+                         shminfo->shmaddr, shminfo,
+                         w, h);
+    if (!buffer->ximage) {
+        X11_XShmDetach(display, shminfo);
+        X11_XSync(display, False);
+        shmdt(shminfo->shmaddr);
+        return SDL_FALSE;
+    }
+    buffer->pending = 0;
+    return SDL_TRUE;
+}
+
+static Bool
+X11_IsShmCompletion(Display *display, XEvent *event, XPointer arg)
+{
+    X11_ShmBuffer *buffer = (X11_ShmBuffer *) arg;
+
+    return (event->type == X11_XShmGetEventBase(display) + ShmCompletion &&
+            ((XShmCompletionEvent *) event)->shmseg == buffer->shminfo.shmseg);
+}
+
+void
+X11_HandleShmCompletion(SDL_VideoData *videodata, XEvent *event)
+{
+    const ShmSeg shmseg = ((XShmCompletionEvent *) event)->shmseg;
+    int i, j;
+
+    for (i = 0; i < videodata->numwindows; ++i) {
+        SDL_WindowData *data = videodata->windowlist[i];
+        if (!data) {
+            continue;
+        }
+        for (j = 0; j < data->num_shmbuffers; ++j) {
+            X11_ShmBuffer *buffer = &data->shmbuffers[j];
+            if (buffer->shminfo.shmseg == shmseg && buffer->pending > 0) {
+                --buffer->pending;
+                return;
+            }
+        }
+    }
+}
+
+/* Makes the next image current once the server is done reading it, and
+   brings it up to date with the areas just sent from the current one */
+static int
+X11_RotateShmBuffers(SDL_Window * window, Display *display, int sent)
+{
+    SDL_WindowData *data = (SDL_WindowData *) window->driverdata;
+    X11_ShmBuffer *current = &data->shmbuffers[data->current_shmbuffer];
+    X11_ShmBuffer *next;
+    const int pitch = window->surface->pitch;
+    const int bpp = window->surface->format->BytesPerPixel;
+    XEvent event;
+    int i;
+
+    current->pending += sent;
+    for (i = 0; i < data->num_shmbuffers; ++i) {
+        if (i != data->current_shmbuffer &&
+            SDL_UnionRegion(&data->shmbuffers[i].stale, &data->shmbuffers[i].stale, &data->shmdamage) < 0) {
+            return -1;
+        }
+    }
+
+    data->current_shmbuffer = (data->current_shmbuffer + 1) % data->num_shmbuffers;
+    next = &data->shmbuffers[data->current_shmbuffer];
+
+    /* Take the completions that already arrived. If the server still isn't
+       done with the image, wait with a round trip rather than for the events,
+       so a completion that never comes can't hang here */
+    while (next->pending > 0 &&
+           X11_XCheckIfEvent(display, &event, X11_IsShmCompletion, (XPointer) next)) {
+        --next->pending;
+    }
+    if (next->pending > 0) {
+        X11_XSync(display, False);
+        while (X11_XCheckIfEvent(display, &event, X11_IsShmCompletion, (XPointer) next)) {
+            continue;
+        }
+        next->pending = 0;
+    }
+
+    for (i = 0; i < next->stale.numrects; ++i) {
+        const SDL_Rect *rect = &next->stale.rects[i];
+        const int offset = rect->y * pitch + rect->x * bpp;
+        const Uint8 *src = (const Uint8 *) current->shminfo.shmaddr + offset;
+        Uint8 *dst = (Uint8 *) next->shminfo.shmaddr + offset;
+        int y;
+
+        for (y = 0; y < rect->h; ++y) {
+            SDL_memcpy(dst, src, rect->w * bpp);
+            src += pitch;
+            dst += pitch;
+        }
+    }
+    next->stale.numrects = 0;
+
+    data->ximage = next->ximage;
+    window->surface->pixels = next->shminfo.shmaddr;
+    return 0;
+}
+
 #endif /* !NO_SHARED_MEMORY */
 
 int
@@ -87,42 +220,37 @@ X11_CreateWindowFramebuffer(_THIS, SDL_Window * window, Uint32 * format,
     /* Create the actual image */
 #ifndef NO_SHARED_MEMORY
     if (have_mitshm()) {
-        XShmSegmentInfo *shminfo = &data->shminfo;
-
-        shminfo->shmid = shmget(IPC_PRIVATE, window->h*(*pitch), IPC_CREAT | 0777);
-        if ( shminfo->shmid >= 0 ) {
-            shminfo->shmaddr = (char *)shmat(shminfo->shmid, 0, 0);
-            shminfo->readOnly = False;
-            if ( shminfo->shmaddr != (char *)-1 ) {
-                shm_error = False;
-                X_handler = X11_XSetErrorHandler(shm_errhandler);
-                X11_XShmAttach(display, shminfo);
-                X11_XSync(display, False);
-                X11_XSetErrorHandler(X_handler);
-                if ( shm_error )
-                    shmdt(shminfo->shmaddr);
-            } else {
-                shm_error = True;
+        const char *hint = SDL_GetHint(SDL_HINT_VIDEO_X11_SHM_BUFFERS);
+        int numbuffers = hint ? SDL_atoi(hint) : 1;
+        int event_base = 0;
+        int i;
+
+        numbuffers = SDL_max(1, SDL_min(numbuffers, X11_MAX_SHM_BUFFERS));
+        if (numbuffers > 1) {
+            /* Rotating needs the completion events, which can't be core events */
+            event_base = X11_XShmGetEventBase(display);
+            if (event_base < LASTEvent) {
+                numbuffers = 1;
             }
-            shmctl(shminfo->shmid, IPC_RMID, NULL);
-        } else {
-            shm_error = True;
         }
-        if (!shm_error) {
-            data->ximage = X11_XShmCreateImage(display, data->visual,
-                             vinfo.depth, ZPixmap,
-                             shminfo->shmaddr, shminfo,
-                             window->w, window->h);
-            if (!data->ximage) {
-                X11_XShmDetach(display, shminfo);
-                X11_XSync(display, False);
-                shmdt(shminfo->shmaddr);
-            } else {
-                /* Done! */
-                data->use_mitshm = SDL_TRUE;
-                *pixels = shminfo->shmaddr;
-                return 0;
+        for (i = 0; i < numbuffers; ++i) {
+            if (!X11_CreateShmBuffer(display, data->visual, vinfo.depth,
+                                     window->w, window->h, window->h*(*pitch),
+                                     &data->shmbuffers[i])) {
+                break;
+            }
+        }
+        if (i > 0) {
+            /* Done! */
+            data->use_mitshm = SDL_TRUE;
+            data->num_shmbuffers = i;
+            data->current_shmbuffer = 0;
+            data->ximage = data->shmbuffers[0].ximage;
+            if (data->num_shmbuffers > 1) {
+                data->videodata->shm_completion_event = event_base + ShmCompletion;
             }
+            *pixels = data->shmbuffers[0].shminfo.shmaddr;
+            return 0;
         }
     }
 #endif /* not NO_SHARED_MEMORY */
@@ -152,6 +280,9 @@ X11_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects,
     int x, y, w ,h;
 #ifndef NO_SHARED_MEMORY
     if (data->use_mitshm) {
+        const Bool send_event = (data->num_shmbuffers > 1) ? True : False;
+        int sent = 0;
+
         for (i = 0; i < numrects; ++i) {
             x = rects[i].x;
             y = rects[i].y;
@@ -178,7 +309,27 @@ X11_UpdateWindowFramebuffer(_THIS, SDL_Window * window, const SDL_Rect * rects,
                 h = window->h - y;
 
             X11_XShmPutImage(display, data->xwindow, data->gc, data->ximage,
-                x, y, x, y, w, h, False);
+                x, y, x, y, w, h, send_event);
+            ++sent;
+        }
+
+        if (send_event) {
+            /* Don't wait for the server, draw the next frame into another image */
+            SDL_Rect bounds;
+
+            bounds.x = 0;
+            bounds.y = 0;
+            bounds.w = window->w;
+            bounds.h = window->h;
+            if (SDL_SetRegionRects(&data->shmdamage, rects, numrects) < 0) {
+                return -1;
+            }
+            SDL_IntersectRegionRect(&data->shmdamage, &bounds);
+            if (X11_RotateShmBuffers(window, display, sent) < 0) {
+                return -1;
+            }
+            X11_XFlush(display);
+            return 0;
         }
     }
     else
@@ -232,18 +383,31 @@ X11_DestroyWindowFramebuffer(_THIS, SDL_Window * window)
 
     display = data->videodata->display;
 
-    if (data->ximage) {
-        XDestroyImage(data->ximage);
-
 #ifndef NO_SHARED_MEMORY
-        if (data->use_mitshm) {
-            X11_XShmDetach(display, &data->shminfo);
-            X11_XSync(display, False);
-            shmdt(data->shminfo.shmaddr);
-            data->use_mitshm = SDL_FALSE;
+    if (data->use_mitshm) {
+        int i;
+
+        for (i = 0; i < data->num_shmbuffers; ++i) {
+            XDestroyImage(data->shmbuffers[i].ximage);
+            X11_XShmDetach(display, &data->shmbuffers[i].shminfo);
+        }
+        /* The server may still be reading the segments until this returns */
+        X11_XSync(display, False);
+        for (i = 0; i < data->num_shmbuffers; ++i) {
+            shmdt(data->shmbuffers[i].shminfo.shmaddr);
+            SDL_FreeRegion(&data->shmbuffers[i].stale);
+            data->shmbuffers[i].ximage = NULL;
+            data->shmbuffers[i].pending = 0;
         }
+        SDL_FreeRegion(&data->shmdamage);
+        data->num_shmbuffers = 0;
+        data->use_mitshm = SDL_FALSE;
+        data->ximage = NULL;
+    }
 #endif /* !NO_SHARED_MEMORY */
 
+    if (data->ximage) {
+        XDestroyImage(data->ximage);
         data->ximage = NULL;
     }
     if (data->gc) {
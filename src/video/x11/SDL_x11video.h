@@ -84,6 +84,7 @@ typedef struct SDL_VideoData
     int windowlistlength;
     XID window_group;
     Window clipboard_window;
+    int shm_completion_event;   /* 0 until a window uses more than one MIT-SHM buffer */
 
     /* This is true for ICCCM2.0-compliant window managers */
     SDL_bool net_wm;
@@ -40,6 +40,18 @@ typedef enum
     PENDING_FOCUS_OUT
 } PendingFocusEnum;
 
+#ifndef NO_SHARED_MEMORY
+#define X11_MAX_SHM_BUFFERS 3
+
+typedef struct
+{
+    XShmSegmentInfo shminfo;
+    XImage *ximage;
+    int pending;        /* XShmPutImage() requests the server hasn't completed */
+    SDL_Region stale;   /* areas updated from other buffers since this one was current */
+} X11_ShmBuffer;
+#endif
+
 typedef struct
 {
     SDL_Window *window;
@@ -50,7 +62,10 @@ typedef struct
 #ifndef NO_SHARED_MEMORY
     /* MIT shared memory extension information */
     SDL_bool use_mitshm;
-    XShmSegmentInfo shminfo;
+    X11_ShmBuffer shmbuffers[X11_MAX_SHM_BUFFERS];
+    int num_shmbuffers;
+    int current_shmbuffer;
+    SDL_Region shmdamage;
 #endif
     XImage *ximage;
     GC gc;
@@ -486,6 +486,7 @@ void SSE_FUNCTION_NAME(uint32_t width, uint32_t height,
 #undef SAVE_SI128
 #undef UV2RGB_16
 #undef ADD_Y2RGB_16
+#undef PACK_RGB565_32
 #undef PACK_RGB24_32_STEP1
 #undef PACK_RGB24_32_STEP2
 #undef PACK_RGB24_32
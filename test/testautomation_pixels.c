@@ -500,6 +500,399 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/* Reference RGB to YUV conversion, JPEG with full range, BT.601 and BT.709 with limited range */
+static int
+_yuvReference(SDL_YUV_CONVERSION_MODE mode, int channel, int r, int g, int b)
+{
+  static const float factors[3][3][4] = {
+    { /* JPEG */
+      {   0.0f,  0.2990f,  0.5870f,  0.1140f },
+      { 128.0f, -0.1687f, -0.3313f,  0.5000f },
+      { 128.0f,  0.5000f, -0.4187f, -0.0813f }
+    },
+    { /* BT.601 */
+      {  16.0f,  0.2568f,  0.5041f,  0.0979f },
+      { 128.0f, -0.1482f, -0.2910f,  0.4392f },
+      { 128.0f,  0.4392f, -0.3678f, -0.0714f }
+    },
+    { /* BT.709 */
+      {  16.0f,  0.1826f,  0.6142f,  0.0620f },
+      { 128.0f, -0.1006f, -0.3386f,  0.4392f },
+      { 128.0f,  0.4392f, -0.3989f, -0.0403f }
+    }
+  };
+  const float *f = factors[mode][channel];
+  float value = f[0] + f[1] * r + f[2] * g + f[3] * b;
+
+  if (value < 0.0f) {
+    value = 0.0f;
+  } else if (value > 255.0f) {
+    value = 255.0f;
+  }
+  return (int)(value + 0.5f);
+}
+
+/* Averages the 2x2 block of pixels at x, y, repeating the last row and column */
+static void
+_yuvAverage(const Uint32 *pixels, int w, int h, int x, int y, int rows, int *r, int *g, int *b)
+{
+  const int x1 = (x + 1 < w) ? x + 1 : x;
+  const int y1 = (rows == 2 && y + 1 < h) ? y + 1 : y;
+  const Uint32 p[4] = { pixels[y * w + x], pixels[y * w + x1], pixels[y1 * w + x], pixels[y1 * w + x1] };
+  int i;
+
+  *r = *g = *b = 0;
+  for (i = 0; i < 4; i++) {
+    *r += (p[i] >> 16) & 0xFF;
+    *g += (p[i] >> 8) & 0xFF;
+    *b += p[i] & 0xFF;
+  }
+  *r /= 4;
+  *g /= 4;
+  *b /= 4;
+}
+
+/**
+ * @brief Call to SDL_ConvertPixels from ARGB8888 to the YUV formats
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_ConvertPixels
+ */
+int
+pixels_convertRGBtoYUV(void *arg)
+{
+  const Uint32 formats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  const SDL_YUV_CONVERSION_MODE modes[] = {
+    SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709
+  };
+  const char *mode_names[] = { "JPEG", "BT.601", "BT.709" };
+  /* Odd sizes, wide enough for the SIMD kernels and their tails */
+  const int w = 37;
+  const int h = 5;
+  const int pitch = 80;
+  const int cw = (w + 1) / 2;
+  const int ch = (h + 1) / 2;
+  Uint32 pixels[37 * 5];
+  Uint8 yuv[80 * 5 * 2];
+  SDL_YUV_CONVERSION_MODE mode;
+  int i, m, x, y, c;
+  int result;
+  int errors;
+
+  for (i = 0; i < SDL_arraysize(pixels); i++) {
+    pixels[i] = SDLTest_RandomUint32();
+  }
+  /* Saturated colors give the extremes of U and V */
+  pixels[0] = 0xFF0000FF;
+  pixels[1] = 0xFFFF0000;
+
+  mode = SDL_GetYUVConversionMode();
+  for (m = 0; m < SDL_arraysize(modes); m++) {
+    SDL_SetYUVConversionMode(modes[m]);
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+      const Uint32 format = formats[i];
+      const SDL_bool packed = (format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU);
+
+      result = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, pixels, w * 4, format, yuv, pitch);
+      SDLTest_AssertCheck(result == 0, "Verify result from SDL_ConvertPixels to %s, expected: 0, got: %i",
+        SDL_GetPixelFormatName(format), result);
+
+      errors = 0;
+      for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+          const Uint32 p = pixels[y * w + x];
+          const int expected = _yuvReference(modes[m], 0, (p >> 16) & 0xFF, (p >> 8) & 0xFF, p & 0xFF);
+          int actual;
+          if (packed) {
+            const int offset = (format == SDL_PIXELFORMAT_UYVY) ? 1 : 0;
+            actual = yuv[y * pitch + x * 2 + offset];
+          } else {
+            actual = yuv[y * pitch + x];
+          }
+          if (SDL_abs(actual - expected) > 1) {
+            errors++;
+          }
+        }
+      }
+      SDLTest_AssertCheck(errors == 0, "Verify %s Y values for %s, expected: 0 errors, got: %i",
+        mode_names[m], SDL_GetPixelFormatName(format), errors);
+
+      errors = 0;
+      for (y = 0; y < (packed ? h : ch); y++) {
+        for (x = 0; x < cw; x++) {
+          int r, g, b, u, v;
+          if (packed) {
+            const Uint8 *pair = &yuv[y * pitch + x * 4];
+            _yuvAverage(pixels, w, h, 2 * x, y, 1, &r, &g, &b);
+            switch (format) {
+              case SDL_PIXELFORMAT_YUY2: u = pair[1]; v = pair[3]; break;
+              case SDL_PIXELFORMAT_UYVY: u = pair[0]; v = pair[2]; break;
+              default: v = pair[1]; u = pair[3]; break;
+            }
+          } else {
+            const Uint8 *planes = &yuv[h * pitch];
+            const int cpitch = (pitch + 1) / 2;
+            _yuvAverage(pixels, w, h, 2 * x, 2 * y, 2, &r, &g, &b);
+            switch (format) {
+              case SDL_PIXELFORMAT_YV12: v = planes[y * cpitch + x]; u = planes[ch * cpitch + y * cpitch + x]; break;
+              case SDL_PIXELFORMAT_IYUV: u = planes[y * cpitch + x]; v = planes[ch * cpitch + y * cpitch + x]; break;
+              case SDL_PIXELFORMAT_NV12: u = planes[y * 2 * cpitch + 2 * x]; v = planes[y * 2 * cpitch + 2 * x + 1]; break;
+              default: v = planes[y * 2 * cpitch + 2 * x]; u = planes[y * 2 * cpitch + 2 * x + 1]; break;
+            }
+          }
+          for (c = 1; c <= 2; c++) {
+            const int expected = _yuvReference(modes[m], c, r, g, b);
+            if (SDL_abs((c == 1 ? u : v) - expected) > 1) {
+              errors++;
+            }
+          }
+        }
+      }
+      SDLTest_AssertCheck(errors == 0, "Verify %s U and V values for %s, expected: 0 errors, got: %i",
+        mode_names[m], SDL_GetPixelFormatName(format), errors);
+    }
+  }
+
+  SDL_SetYUVConversionMode(mode);
+
+  return TEST_COMPLETED;
+}
+
+/* BT.601 YUV to RGB, channel 0 is red, 1 green and 2 blue */
+static float
+_rgbReference(int channel, int y, int u, int v)
+{
+  switch (channel) {
+    case 0:
+      return 1.1644f * (y - 16) + 1.5960f * (v - 128);
+    case 1:
+      return 1.1644f * (y - 16) - 0.3918f * (u - 128) - 0.8130f * (v - 128);
+    default:
+      return 1.1644f * (y - 16) + 2.0172f * (u - 128);
+  }
+}
+
+/**
+ * @brief Call to SDL_ConvertPixels from the YUV formats to ARGB8888
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_ConvertPixels
+ */
+int
+pixels_convertYUVtoRGB(void *arg)
+{
+  const Uint32 formats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  /* Odd sizes, wide enough for the SIMD kernels and their tails */
+  const int w = 150;
+  const int h = 33;
+  const int pitch = 304;
+  const int ch = (h + 1) / 2;
+  const int cpitch = (pitch + 1) / 2;
+  Uint8 yuv[304 * 33 * 2];
+  Uint32 pixels[150 * 33];
+  Uint32 threaded[150 * 33];
+  SDL_YUV_CONVERSION_MODE mode;
+  int i, x, y, c;
+  int result;
+  int errors;
+
+  /* Video range values, the fixed point math doesn't cover the rest */
+  for (i = 0; i < SDL_arraysize(yuv); i++) {
+    yuv[i] = (Uint8)SDLTest_RandomIntegerInRange(16, 235);
+  }
+
+  mode = SDL_GetYUVConversionMode();
+  SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_BT601);
+
+  for (i = 0; i < SDL_arraysize(formats); i++) {
+    const Uint32 format = formats[i];
+    const Uint8 *planes = &yuv[h * pitch];
+
+    result = SDL_ConvertPixels(w, h, format, yuv, pitch, SDL_PIXELFORMAT_ARGB8888, pixels, w * 4);
+    SDLTest_AssertCheck(result == 0, "Verify result from SDL_ConvertPixels from %s, expected: 0, got: %i",
+      SDL_GetPixelFormatName(format), result);
+
+    errors = 0;
+    for (y = 0; y < h; y++) {
+      for (x = 0; x < w; x++) {
+        const Uint8 *pair = &yuv[y * pitch + (x / 2) * 4];
+        const Uint32 p = pixels[y * w + x];
+        float expected[3];
+        int Y, u, v;
+        switch (format) {
+          case SDL_PIXELFORMAT_YV12: Y = yuv[y * pitch + x]; v = planes[(y / 2) * cpitch + x / 2]; u = planes[(ch + y / 2) * cpitch + x / 2]; break;
+          case SDL_PIXELFORMAT_IYUV: Y = yuv[y * pitch + x]; u = planes[(y / 2) * cpitch + x / 2]; v = planes[(ch + y / 2) * cpitch + x / 2]; break;
+          case SDL_PIXELFORMAT_NV12: Y = yuv[y * pitch + x]; u = planes[(y / 2) * 2 * cpitch + (x / 2) * 2]; v = planes[(y / 2) * 2 * cpitch + (x / 2) * 2 + 1]; break;
+          case SDL_PIXELFORMAT_NV21: Y = yuv[y * pitch + x]; v = planes[(y / 2) * 2 * cpitch + (x / 2) * 2]; u = planes[(y / 2) * 2 * cpitch + (x / 2) * 2 + 1]; break;
+          case SDL_PIXELFORMAT_YUY2: Y = pair[(x & 1) * 2]; u = pair[1]; v = pair[3]; break;
+          case SDL_PIXELFORMAT_UYVY: Y = pair[(x & 1) * 2 + 1]; u = pair[0]; v = pair[2]; break;
+          default: Y = pair[(x & 1) * 2]; v = pair[1]; u = pair[3]; break;
+        }
+        /* Colors outside of the RGB cube overflow the fixed point math, and
+           the conversion uses 6 bits of precision */
+        for (c = 0; c < 3; c++) {
+          expected[c] = _rgbReference(c, Y, u, v);
+        }
+        if (expected[0] < 0.0f || expected[0] > 255.0f ||
+            expected[1] < 0.0f || expected[1] > 255.0f ||
+            expected[2] < 0.0f || expected[2] > 255.0f) {
+          continue;
+        }
+        for (c = 0; c < 3; c++) {
+          const int actual = (p >> (16 - 8 * c)) & 0xFF;
+          if (SDL_abs(actual - (int)(expected[c] + 0.5f)) > 4) {
+            errors++;
+          }
+        }
+      }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify RGB values from %s, expected: 0 errors, got: %i",
+      SDL_GetPixelFormatName(format), errors);
+
+    /* Splitting the conversion across threads gives identical output */
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, "4");
+    SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "1");
+    result = SDL_ConvertPixels(w, h, format, yuv, pitch, SDL_PIXELFORMAT_ARGB8888, threaded, w * 4);
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, "1");
+    SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "");
+    SDLTest_AssertCheck(result == 0, "Verify result from threaded SDL_ConvertPixels from %s, expected: 0, got: %i",
+      SDL_GetPixelFormatName(format), result);
+    SDLTest_AssertCheck(SDL_memcmp(pixels, threaded, sizeof(pixels)) == 0,
+      "Verify threaded conversion from %s matches", SDL_GetPixelFormatName(format));
+  }
+
+  SDL_SetYUVConversionMode(mode);
+
+  return TEST_COMPLETED;
+}
+
+/* Reference for the palette index SDL_MapRGBA should find */
+static Uint32
+_nearestColor(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+  unsigned int smallest = ~0u;
+  Uint32 pixel = 0;
+  int i;
+
+  for (i = 0; i < palette->ncolors; i++) {
+    const int rd = palette->colors[i].r - r;
+    const int gd = palette->colors[i].g - g;
+    const int bd = palette->colors[i].b - b;
+    const int ad = palette->colors[i].a - a;
+    const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+    if (distance < smallest) {
+      smallest = distance;
+      pixel = i;
+    }
+  }
+  return pixel;
+}
+
+/**
+ * @brief Call to SDL_MapRGB and SDL_MapRGBA with large palettes
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_MapRGB
+ */
+int
+pixels_mapRGBPalette(void *arg)
+{
+  SDL_PixelFormat *format;
+  SDL_Palette *palette;
+  SDL_Color colors[256];
+  int variation, i;
+  int errors;
+
+  format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+  palette = SDL_AllocPalette(256);
+  SDLTest_AssertCheck(format != NULL && palette != NULL, "Verify format and palette are not NULL");
+  if (format == NULL || palette == NULL) return TEST_ABORTED;
+  SDL_SetPixelFormatPalette(format, palette);
+
+  for (variation = 1; variation <= 3; variation++) {
+    for (i = 0; i < 256; i++) {
+      colors[i].r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      colors[i].g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      colors[i].b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    switch (variation) {
+      /* Duplicate colors, the first one is found */
+      case 2:
+        for (i = 0; i < 64; i++) {
+          colors[255 - i] = colors[i];
+        }
+        break;
+      /* Colors with different alpha */
+      case 3:
+        for (i = 0; i < 256; i += 3) {
+          colors[i].a = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+        }
+        break;
+    }
+    SDL_SetPaletteColors(palette, colors, 0, 256);
+    SDLTest_AssertPass("Call to SDL_SetPaletteColors(), variation %d", variation);
+
+    errors = 0;
+    for (i = 0; i < 256; i++) {
+      if (SDL_MapRGBA(format, colors[i].r, colors[i].g, colors[i].b, colors[i].a) !=
+          _nearestColor(palette, colors[i].r, colors[i].g, colors[i].b, colors[i].a)) {
+        errors++;
+      }
+    }
+    for (i = 0; i < 10000; i++) {
+      const Uint8 r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      const Uint8 g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      const Uint8 b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      const Uint8 a = (i & 1) ? SDL_ALPHA_OPAQUE : (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      if (SDL_MapRGB(format, r, g, b) != _nearestColor(palette, r, g, b, SDL_ALPHA_OPAQUE)) {
+        errors++;
+      }
+      if (SDL_MapRGBA(format, r, g, b, a) != _nearestColor(palette, r, g, b, a)) {
+        errors++;
+      }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify mapped colors, expected: 0 errors, got: %i", errors);
+  }
+
+  /* Colors changed directly, with a version bump instead of SDL_SetPaletteColors(), after lookups in an opaque palette */
+  for (i = 0; i < 256; i++) {
+    colors[i].a = SDL_ALPHA_OPAQUE;
+  }
+  SDL_SetPaletteColors(palette, colors, 0, 256);
+  for (i = 0; i < 256; i++) {
+    SDL_MapRGB(format, colors[i].r, colors[i].g, colors[i].b);
+  }
+  for (variation = 1; variation <= 2; variation++) {
+    for (i = 0; i < 256; i++) {
+      palette->colors[i].r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      palette->colors[i].g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      palette->colors[i].b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      palette->colors[i].a = SDL_ALPHA_OPAQUE;
+    }
+    palette->version++;
+    errors = 0;
+    for (i = 0; i < 10000; i++) {
+      const Uint8 r = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      const Uint8 g = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      const Uint8 b = (Uint8)SDLTest_RandomIntegerInRange(0, 255);
+      if (SDL_MapRGB(format, r, g, b) != _nearestColor(palette, r, g, b, SDL_ALPHA_OPAQUE)) {
+        errors++;
+      }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify mapped colors after changing the palette directly, expected: 0 errors, got: %i", errors);
+  }
+
+  SDL_FreeFormat(format);
+  SDL_FreePalette(palette);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -515,9 +908,19 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_convertRGBtoYUV, "pixels_convertRGBtoYUV", "Call to SDL_ConvertPixels from ARGB8888 to YUV formats", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest6 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVtoRGB, "pixels_convertYUVtoRGB", "Call to SDL_ConvertPixels from YUV formats to ARGB8888", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest7 =
+        { (SDLTest_TestCaseFp)pixels_mapRGBPalette, "pixels_mapRGBPalette", "Call to SDL_MapRGB and SDL_MapRGBA with large palettes", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6,
+    &pixelsTest7, NULL
 };
 
 /* Pixels test suite (global) */
@@ -420,6 +420,880 @@ render_testBlit(void *arg)
 }
 
 
+/**
+ * @brief Tests that a textured quad drawn with SDL_RenderGeometry matches SDL_RenderCopy.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGeometry
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopy
+ */
+int
+render_testGeometry(void *arg)
+{
+   int ret;
+   SDL_Rect rect;
+   SDL_Texture *tface;
+   SDL_Surface *referenceSurface = NULL;
+   SDL_Vertex verts[4];
+   const int indices[6] = { 0, 1, 2, 2, 1, 3 };
+   int tw, th, i;
+
+   /* Create face surface. */
+   tface = _loadTestFace();
+   SDLTest_AssertCheck(tface != NULL,  "Verify _loadTestFace() result");
+   if (tface == NULL) {
+       return TEST_ABORTED;
+   }
+
+   ret = SDL_QueryTexture(tface, NULL, NULL, &tw, &th);
+   SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+
+   /* Render the reference with a plain copy. */
+   _clearScreen();
+   rect.x = 7;
+   rect.y = 5;
+   rect.w = tw;
+   rect.h = th;
+   ret = SDL_RenderCopy(renderer, tface, NULL, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+
+   referenceSurface = SDL_CreateRGBSurface(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32,
+                                           RENDER_COMPARE_RMASK, RENDER_COMPARE_GMASK, RENDER_COMPARE_BMASK, RENDER_COMPARE_AMASK);
+   SDLTest_AssertCheck(referenceSurface != NULL, "Verify result from SDL_CreateRGBSurface is not NULL");
+   if (referenceSurface == NULL) {
+       SDL_DestroyTexture(tface);
+       return TEST_ABORTED;
+   }
+   /* Explicitly specify the rect in case the window isn't the expected size... */
+   rect.x = 0;
+   rect.y = 0;
+   rect.w = TESTRENDER_SCREEN_W;
+   rect.h = TESTRENDER_SCREEN_H;
+   ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, referenceSurface->pixels, referenceSurface->pitch);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+
+   /* Now draw the same quad as two triangles sharing an edge. */
+   rect.x = 7;
+   rect.y = 5;
+   rect.w = tw;
+   rect.h = th;
+   _clearScreen();
+   for (i = 0; i < 4; i++) {
+      verts[i].position.x = (float)(rect.x + ((i & 1) ? rect.w : 0));
+      verts[i].position.y = (float)(rect.y + ((i & 2) ? rect.h : 0));
+      verts[i].color.r = verts[i].color.g = verts[i].color.b = verts[i].color.a = 255;
+      verts[i].tex_coord.x = (i & 1) ? 1.0f : 0.0f;
+      verts[i].tex_coord.y = (i & 2) ? 1.0f : 0.0f;
+   }
+   ret = SDL_RenderGeometry(renderer, tface, verts, 4, indices, 6);
+   if (ret != 0) {
+       SDLTest_Log("SDL_RenderGeometry() not supported by this renderer: %s", SDL_GetError());
+       SDL_DestroyTexture(tface);
+       SDL_FreeSurface(referenceSurface);
+       return TEST_SKIPPED;
+   }
+
+   /* Out of range indices are rejected. */
+   ret = SDL_RenderGeometry(renderer, tface, verts, 3, indices, 6);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGeometry with bad indices, expected: -1, got: %i", ret);
+
+   SDL_RenderPresent(renderer);
+
+   /* See if it's the same */
+   _compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+
+   /* Clean up. */
+   SDL_DestroyTexture(tface);
+   SDL_FreeSurface(referenceSurface);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests the per frame renderer statistics.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderGetStats
+ */
+int
+render_testRenderStats(void *arg)
+{
+   int ret;
+   int i;
+   SDL_Rect rect;
+   SDL_Texture *texture;
+   SDL_RenderStats stats;
+   SDL_RenderCopyItem items[8];
+   Uint32 pixels[4 * 4];
+
+   /* Invalid parameters. */
+   ret = SDL_RenderGetStats(renderer, NULL);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetStats(renderer, NULL), expected: -1, got: %i", ret);
+
+   texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 4, 4);
+   SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture is not NULL");
+   if (texture == NULL) {
+       return TEST_ABORTED;
+   }
+
+   /* Start from a fresh frame. */
+   SDL_RenderPresent(renderer);
+
+   SDL_memset(pixels, 0xFF, sizeof (pixels));
+   ret = SDL_UpdateTexture(texture, NULL, pixels, 4 * sizeof (Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+
+   ret = SDL_SetRenderDrawColor(renderer, 13, 73, 200, SDL_ALPHA_OPAQUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+   for (i = 0; i < 3; i++) {
+      rect.x = i * 10;
+      rect.y = 0;
+      rect.w = 5;
+      rect.h = 5;
+      ret = SDL_RenderFillRect(renderer, &rect);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+   }
+   ret = SDL_RenderCopy(renderer, texture, NULL, NULL);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+
+   ret = SDL_RenderGetStats(renderer, &stats);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.commands_queued >= 4, "Validate commands_queued, expected: >= 4, got: %u", (unsigned int) stats.commands_queued);
+   SDLTest_AssertCheck(stats.commands_executed > 0 && stats.commands_executed <= stats.commands_queued,
+                       "Validate commands_executed, expected: 1 to %u, got: %u",
+                       (unsigned int) stats.commands_queued, (unsigned int) stats.commands_executed);
+   SDLTest_AssertCheck(stats.flushes >= 1, "Validate flushes, expected: >= 1, got: %u", (unsigned int) stats.flushes);
+   SDLTest_AssertCheck(stats.texture_uploads == 1, "Validate texture_uploads, expected: 1, got: %u", (unsigned int) stats.texture_uploads);
+   SDLTest_AssertCheck(stats.texture_upload_bytes == sizeof (pixels), "Validate texture_upload_bytes, expected: %u, got: %u",
+                       (unsigned int) sizeof (pixels), (unsigned int) stats.texture_upload_bytes);
+   SDLTest_AssertCheck(stats.target_switches == 0, "Validate target_switches, expected: 0, got: %u", (unsigned int) stats.target_switches);
+
+   /* The counters are per frame. */
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderGetStats(renderer, &stats);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.commands_queued == 0, "Validate commands_queued, expected: 0, got: %u", (unsigned int) stats.commands_queued);
+   SDLTest_AssertCheck(stats.texture_uploads == 0, "Validate texture_uploads, expected: 0, got: %u", (unsigned int) stats.texture_uploads);
+
+   /* Every copy of a batch is counted, even when it's appended to the previous command. */
+   SDL_zero(items);
+   for (i = 0; i < SDL_arraysize(items); i++) {
+      items[i].dstrect.x = (float) (i * 5);
+      items[i].dstrect.w = 4.0f;
+      items[i].dstrect.h = 4.0f;
+      items[i].color.r = items[i].color.g = items[i].color.b = items[i].color.a = 255;
+   }
+   ret = SDL_RenderCopyBatch(renderer, texture, items, SDL_arraysize(items));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderGetStats(renderer, &stats);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(stats.commands_queued >= SDL_arraysize(items), "Validate commands_queued, expected: >= %u, got: %u",
+                       (unsigned int) SDL_arraysize(items), (unsigned int) stats.commands_queued);
+   SDLTest_AssertCheck(stats.commands_executed > 0 && stats.commands_executed <= stats.commands_queued,
+                       "Validate commands_executed, expected: 1 to %u, got: %u",
+                       (unsigned int) stats.commands_queued, (unsigned int) stats.commands_executed);
+
+   SDL_DestroyTexture(texture);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests recording and replaying a command list.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderBeginCommandList
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderReplayCommandList
+ */
+int
+render_testCommandList(void *arg)
+{
+   int ret;
+   int i;
+   SDL_Rect rect;
+   SDL_RenderCommandList *list;
+   Uint32 pixel;
+   SDL_Surface *surface;
+   SDL_Renderer *other;
+   const struct { int x, y; Uint32 expected; } probes[] = {
+      { 15, 15, 0xFFFF0000 },   /* replayed in place */
+      { 55, 20, 0xFFFF0000 },   /* replayed with an offset */
+      { 35, 25, 0xFF000000 },   /* between the two */
+      { 5, 5, 0xFF000000 }
+   };
+
+   _clearScreen();
+
+   ret = SDL_RenderBeginCommandList(renderer);
+   if (ret < 0) {
+      SDLTest_Log("Command lists not supported by this renderer, skipping");
+      return TEST_SKIPPED;
+   }
+
+   ret = SDL_RenderBeginCommandList(renderer);
+   SDLTest_AssertCheck(ret == -1, "Validate result from nested SDL_RenderBeginCommandList, expected: -1, got: %i", ret);
+
+   ret = SDL_SetRenderDrawColor(renderer, 255, 0, 0, SDL_ALPHA_OPAQUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 20;
+   rect.h = 20;
+   ret = SDL_RenderFillRect(renderer, &rect);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderFillRect, expected: 0, got: %i", ret);
+
+   list = SDL_RenderEndCommandList(renderer);
+   SDLTest_AssertCheck(list != NULL, "Verify result from SDL_RenderEndCommandList is not NULL");
+   if (list == NULL) {
+      return TEST_ABORTED;
+   }
+   SDLTest_AssertCheck(SDL_RenderEndCommandList(renderer) == NULL, "Verify SDL_RenderEndCommandList without recording returns NULL");
+
+   /* Nothing is drawn until the list is replayed. */
+   rect.w = rect.h = 1;
+   rect.x = rect.y = 15;
+   ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, &pixel, sizeof (pixel));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+   SDLTest_AssertCheck(pixel == 0xFF000000, "Validate recorded list wasn't drawn, expected: 0xFF000000, got: 0x%.8x", (unsigned int) pixel);
+
+   ret = SDL_SetRenderDrawColor(renderer, 0, 255, 0, SDL_ALPHA_OPAQUE);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawColor, expected: 0, got: %i", ret);
+   ret = SDL_RenderReplayCommandList(renderer, list, 0, 0);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReplayCommandList, expected: 0, got: %i", ret);
+   ret = SDL_RenderReplayCommandList(renderer, list, 40, 5);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReplayCommandList with offset, expected: 0, got: %i", ret);
+
+   for (i = 0; i < SDL_arraysize(probes); i++) {
+      rect.x = probes[i].x;
+      rect.y = probes[i].y;
+      ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, &pixel, sizeof (pixel));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+      SDLTest_AssertCheck(pixel == probes[i].expected, "Validate pixel at %i,%i, expected: 0x%.8x, got: 0x%.8x",
+                          probes[i].x, probes[i].y, (unsigned int) probes[i].expected, (unsigned int) pixel);
+   }
+
+   SDL_DestroyRenderCommandList(list);
+
+   /* A list outlives its renderer, and a new renderer may reuse its memory */
+   surface = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+   if (surface == NULL) {
+      return TEST_ABORTED;
+   }
+   other = SDL_CreateSoftwareRenderer(surface);
+   SDLTest_AssertCheck(other != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   ret = SDL_RenderBeginCommandList(other);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderBeginCommandList, expected: 0, got: %i", ret);
+   SDL_RenderClear(other);
+   list = SDL_RenderEndCommandList(other);
+   SDLTest_AssertCheck(list != NULL, "Verify result from SDL_RenderEndCommandList is not NULL");
+   ret = SDL_RenderReplayCommandList(renderer, list, 0, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderReplayCommandList on another renderer, expected: -1, got: %i", ret);
+   SDL_DestroyRenderer(other);
+   other = SDL_CreateSoftwareRenderer(surface);
+   SDLTest_AssertCheck(other != NULL, "Verify result from SDL_CreateSoftwareRenderer is not NULL");
+   ret = SDL_RenderReplayCommandList(other, list, 0, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderReplayCommandList on a new renderer, expected: -1, got: %i", ret);
+   SDL_DestroyRenderer(other);
+   SDL_DestroyRenderCommandList(list);
+   SDL_FreeSurface(surface);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests copying many rectangles of a texture in one call.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderCopyBatch
+ */
+int
+render_testCopyBatch(void *arg)
+{
+   int ret;
+   int i;
+   SDL_Rect rect;
+   SDL_Texture *texture;
+   SDL_RenderCopyItem items[3];
+   Uint32 pixels[4 * 4];
+   Uint32 pixel;
+   const struct { int x, y; Uint32 expected; } probes[] = {
+      { 1, 1, 0xFFFF0000 },     /* red item */
+      { 11, 1, 0xFF00FF00 },    /* green item */
+      { 22, 2, 0xFFFFFFFF },    /* flipped item */
+      { 7, 1, 0xFF000000 }      /* between the items */
+   };
+
+   _clearScreen();
+
+   SDL_memset(pixels, 0xFF, sizeof (pixels));
+   texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 4, 4);
+   SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture is not NULL");
+   if (texture == NULL) {
+      return TEST_ABORTED;
+   }
+   ret = SDL_UpdateTexture(texture, NULL, pixels, 4 * sizeof (Uint32));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+
+   ret = SDL_RenderCopyBatch(renderer, texture, NULL, 1);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyBatch with NULL items, expected: -1, got: %i", ret);
+
+   SDL_zero(items);
+   for (i = 0; i < SDL_arraysize(items); i++) {
+      items[i].dstrect.x = (float) (i * 10);
+      items[i].dstrect.w = 4.0f;
+      items[i].dstrect.h = 4.0f;
+      items[i].color.r = items[i].color.g = items[i].color.b = items[i].color.a = 255;
+   }
+   items[0].color.g = items[0].color.b = 0;
+   items[1].color.r = items[1].color.b = 0;
+   items[2].srcrect.w = items[2].srcrect.h = 2;
+   items[2].flip = SDL_FLIP_HORIZONTAL;
+
+   ret = SDL_RenderCopyBatch(renderer, texture, items, SDL_arraysize(items));
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatch, expected: 0, got: %i", ret);
+
+   rect.w = rect.h = 1;
+   for (i = 0; i < SDL_arraysize(probes); i++) {
+      rect.x = probes[i].x;
+      rect.y = probes[i].y;
+      ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, &pixel, sizeof (pixel));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+      SDLTest_AssertCheck(pixel == probes[i].expected, "Validate pixel at %i,%i, expected: 0x%.8x, got: 0x%.8x",
+                          probes[i].x, probes[i].y, (unsigned int) probes[i].expected, (unsigned int) pixel);
+   }
+
+   SDL_DestroyTexture(texture);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Tests scaling textures with nearest and linear filtering.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SCALE_QUALITY
+ */
+int
+render_testScaleQuality(void *arg)
+{
+   int ret;
+   int i, j;
+   SDL_Rect rect;
+   SDL_Texture *texture;
+   const Uint32 pixels[2] = { 0xFF000000, 0xFFFFFFFF };
+   Uint32 result[4];
+   char *hint;
+   const struct { const char *quality; SDL_BlendMode blend; int expected[4]; } cases[] = {
+      { "nearest", SDL_BLENDMODE_NONE, { 0, 0, 255, 255 } },
+      { "linear", SDL_BLENDMODE_NONE, { 0, 64, 191, 255 } },
+      { "linear", SDL_BLENDMODE_BLEND, { 0, 64, 191, 255 } }
+   };
+
+   hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY)) : NULL;
+
+   _clearScreen();
+
+   for (i = 0; i < SDL_arraysize(cases); i++) {
+      SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, cases[i].quality);
+      texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 2, 1);
+      SDLTest_AssertCheck(texture != NULL, "Verify result from SDL_CreateTexture is not NULL");
+      if (texture == NULL) {
+         break;
+      }
+      ret = SDL_UpdateTexture(texture, NULL, pixels, sizeof (pixels));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_UpdateTexture, expected: 0, got: %i", ret);
+      ret = SDL_SetTextureBlendMode(texture, cases[i].blend);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetTextureBlendMode, expected: 0, got: %i", ret);
+
+      /* Stretch the two pixels over four, sampling at the pixel centers */
+      rect.x = 0;
+      rect.y = i;
+      rect.w = 4;
+      rect.h = 1;
+      ret = SDL_RenderCopy(renderer, texture, NULL, &rect);
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+      SDL_DestroyTexture(texture);
+
+      ret = SDL_RenderReadPixels(renderer, &rect, SDL_PIXELFORMAT_ARGB8888, result, sizeof (result));
+      SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+      for (j = 0; j < SDL_arraysize(result); j++) {
+         /* Allow for the rounding of hardware texture filtering */
+         const int red = (int) ((result[j] >> 16) & 0xFF);
+         SDLTest_AssertCheck(SDL_abs(red - cases[i].expected[j]) <= 2,
+                             "Validate %s pixel %i, expected: %i, got: %i", cases[i].quality, j, cases[i].expected[j], red);
+      }
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, hint);
+   SDL_free(hint);
+
+   return TEST_COMPLETED;
+}
+
+
+/* A stream that is slow to write, so the capture buffers get reused out of order */
+static size_t SDLCALL
+_slowWrite(SDL_RWops *context, const void *ptr, size_t size, size_t num)
+{
+   SDL_Delay(2);
+   return num;
+}
+
+/**
+ * @brief Tests capturing the presented frames to a stream.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderStartCapture
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderStopCapture
+ */
+int
+render_testCapture(void *arg)
+{
+   int ret;
+   int i;
+   int w, h;
+   size_t frame_size;
+   size_t buffer_size;
+   Uint8 *buffer;
+   SDL_RWops *rw;
+   Sint64 written;
+   Uint32 pixel;
+   char header[64];
+   const Uint8 colors[3][3] = { { 255, 0, 0 }, { 0, 255, 0 }, { 0, 0, 255 } };
+   const int slow_captures[][2] = { { 3, 10 }, { 4, 20 } };   /* buffers, frames */
+
+   ret = SDL_GetRendererOutputSize(renderer, &w, &h);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_GetRendererOutputSize, expected: 0, got: %i", ret);
+   frame_size = (size_t) w * h * 4;
+   buffer_size = frame_size * SDL_arraysize(colors) + 128;
+   buffer = (Uint8 *) SDL_malloc(buffer_size);
+   SDLTest_AssertCheck(buffer != NULL, "Verify capture buffer is not NULL");
+   if (buffer == NULL) {
+      return TEST_ABORTED;
+   }
+
+   ret = SDL_RenderStopCapture(renderer);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderStopCapture without a capture, expected: -1, got: %i", ret);
+
+   /* Raw frames, with fewer buffers than frames so presenting has to wait for the writer */
+   rw = SDL_RWFromMem(buffer, (int) buffer_size);
+   ret = SDL_RenderStartCapture(renderer, rw, 0, SDL_RENDERCAPTURE_RAW, 0);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderStartCapture with no buffers, expected: -1, got: %i", ret);
+   ret = SDL_RenderStartCapture(renderer, rw, 0, SDL_RENDERCAPTURE_RAW, 2);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStartCapture, expected: 0, got: %i", ret);
+   ret = SDL_RenderStartCapture(renderer, rw, 0, SDL_RENDERCAPTURE_RAW, 2);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderStartCapture while capturing, expected: -1, got: %i", ret);
+   for (i = 0; i < SDL_arraysize(colors); i++) {
+      SDL_SetRenderDrawColor(renderer, colors[i][0], colors[i][1], colors[i][2], SDL_ALPHA_OPAQUE);
+      SDL_RenderClear(renderer);
+      SDL_RenderPresent(renderer);
+   }
+   ret = SDL_RenderStopCapture(renderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStopCapture, expected: 0, got: %i", ret);
+   written = SDL_RWtell(rw);
+   SDLTest_AssertCheck(written == (Sint64) (frame_size * SDL_arraysize(colors)),
+                       "Validate size of the raw capture, expected: %i, got: %i",
+                       (int) (frame_size * SDL_arraysize(colors)), (int) written);
+   for (i = 0; i < SDL_arraysize(colors); i++) {
+      const Uint32 expected = 0xFF000000 | (colors[i][0] << 16) | (colors[i][1] << 8) | colors[i][2];
+      SDL_memcpy(&pixel, buffer + frame_size * i + frame_size - 4, sizeof (pixel));
+      SDLTest_AssertCheck(pixel == expected, "Validate last pixel of frame %i, expected: 0x%.8x, got: 0x%.8x",
+                          i, (unsigned int) expected, (unsigned int) pixel);
+   }
+   SDL_RWclose(rw);
+
+   /* A PPM image per frame */
+   rw = SDL_RWFromMem(buffer, (int) buffer_size);
+   ret = SDL_RenderStartCapture(renderer, rw, 1, SDL_RENDERCAPTURE_PPM, 1);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStartCapture, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderStopCapture(renderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStopCapture, expected: 0, got: %i", ret);
+   SDL_snprintf(header, sizeof (header), "P6\n%d %d\n255\n", w, h);
+   SDLTest_AssertCheck(SDL_memcmp(buffer, header, SDL_strlen(header)) == 0, "Validate PPM header");
+   SDLTest_AssertCheck(SDL_memcmp(buffer + SDL_strlen(header), colors[2], 3) == 0, "Validate first PPM pixel");
+
+   /* A YUV4MPEG2 stream */
+   rw = SDL_RWFromMem(buffer, (int) buffer_size);
+   ret = SDL_RenderStartCapture(renderer, rw, 1, SDL_RENDERCAPTURE_Y4M, 2);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStartCapture, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderStopCapture(renderer);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStopCapture, expected: 0, got: %i", ret);
+   SDL_snprintf(header, sizeof (header), "YUV4MPEG2 W%d H%d F", w, h);
+   SDLTest_AssertCheck(SDL_memcmp(buffer, header, SDL_strlen(header)) == 0, "Validate Y4M header");
+   for (i = 0; i < 64 && buffer[i] != '\n'; i++) {
+   }
+   frame_size = (size_t) w * h + 2 * (size_t) ((w + 1) / 2) * ((h + 1) / 2);
+   SDLTest_AssertCheck(SDL_memcmp(buffer + i + 1, "FRAME\n", 6) == 0, "Validate first Y4M frame marker");
+   SDLTest_AssertCheck(SDL_memcmp(buffer + i + 1 + 6 + frame_size, "FRAME\n", 6) == 0, "Validate second Y4M frame marker");
+
+   /* Writes past the end of the stream make stopping fail */
+   rw = SDL_RWFromMem(buffer, (int) (frame_size / 2));
+   ret = SDL_RenderStartCapture(renderer, rw, 1, SDL_RENDERCAPTURE_RAW, 1);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStartCapture, expected: 0, got: %i", ret);
+   SDL_RenderPresent(renderer);
+   ret = SDL_RenderStopCapture(renderer);
+   SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderStopCapture after a failed write, expected: -1, got: %i", ret);
+
+   /* Stopping frees every buffer, whatever order they were handed back in */
+   rw = SDL_AllocRW();
+   SDLTest_AssertCheck(rw != NULL, "Verify slow stream is not NULL");
+   if (rw != NULL) {
+      rw->write = _slowWrite;
+      for (i = 0; i < SDL_arraysize(slow_captures); i++) {
+         int allocations, j;
+
+         SDL_RenderPresent(renderer);
+         allocations = SDL_GetNumAllocations();
+         ret = SDL_RenderStartCapture(renderer, rw, 0, SDL_RENDERCAPTURE_RAW, slow_captures[i][0]);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStartCapture, expected: 0, got: %i", ret);
+         for (j = 0; j < slow_captures[i][1]; j++) {
+            SDL_RenderPresent(renderer);
+         }
+         ret = SDL_RenderStopCapture(renderer);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderStopCapture, expected: 0, got: %i", ret);
+         ret = SDL_GetNumAllocations();
+         SDLTest_AssertCheck(ret == allocations, "Validate allocations after capturing %i frames with %i buffers, expected: %i, got: %i",
+                             slow_captures[i][1], slow_captures[i][0], allocations, ret);
+      }
+      SDL_FreeRW(rw);
+   }
+
+   SDL_free(buffer);
+
+   return TEST_COMPLETED;
+}
+
+
+/* Pixels of the window surface presented since the last reset */
+typedef struct
+{
+   int w, h;
+   int frames;
+   Uint8 covered[64 * 48];
+} _PresentCoverage;
+
+static void SDLCALL
+_recordPresentedRects(SDL_Window *win, SDL_Surface *frame, const SDL_Rect *rects, int numrects, void *data)
+{
+   _PresentCoverage *coverage = (_PresentCoverage *) data;
+   int i, x, y;
+
+   coverage->frames++;
+   for (i = 0; i < numrects; i++) {
+      for (y = rects[i].y; y < rects[i].y + rects[i].h; y++) {
+         for (x = rects[i].x; x < rects[i].x + rects[i].w; x++) {
+            if (x >= 0 && y >= 0 && x < coverage->w && y < coverage->h) {
+               coverage->covered[y * coverage->w + x] = 1;
+            }
+         }
+      }
+   }
+}
+
+/* Returns the number of pixels in rect that weren't presented */
+static int
+_countUnpresented(const _PresentCoverage *coverage, const SDL_Rect *rect)
+{
+   int x, y;
+   int missing = 0;
+
+   for (y = rect->y; y < rect->y + rect->h; y++) {
+      for (x = rect->x; x < rect->x + rect->w; x++) {
+         if (!coverage->covered[y * coverage->w + x]) {
+            missing++;
+         }
+      }
+   }
+   return missing;
+}
+
+/**
+ * @brief Tests that the software renderer presents every area it drew to.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderPresent
+ * http://wiki.libsdl.org/moin.cgi/SDL_SetWindowFrameCallback
+ */
+int
+render_testPresentDamage(void *arg)
+{
+   SDL_Window *win;
+   SDL_Renderer *sw;
+   SDL_Texture *sprite;
+   SDL_Rect full, oldpos, newpos;
+   SDL_Event event;
+   Uint32 pixels[8 * 8];
+   _PresentCoverage *coverage;
+   int ret;
+
+   coverage = (_PresentCoverage *) SDL_calloc(1, sizeof (*coverage));
+   SDLTest_AssertCheck(coverage != NULL, "Verify coverage buffer is not NULL");
+   if (coverage == NULL) {
+      return TEST_ABORTED;
+   }
+   coverage->w = 64;
+   coverage->h = 48;
+   full.x = 0;
+   full.y = 0;
+   full.w = coverage->w;
+   full.h = coverage->h;
+
+   win = SDL_CreateWindow("render_testPresentDamage", 0, 0, coverage->w, coverage->h, 0);
+   SDLTest_AssertCheck(win != NULL, "Verify result from SDL_CreateWindow is not NULL");
+   if (win == NULL) {
+      SDL_free(coverage);
+      return TEST_ABORTED;
+   }
+   sw = SDL_CreateRenderer(win, -1, SDL_RENDERER_SOFTWARE);
+   SDLTest_AssertCheck(sw != NULL, "Verify result from SDL_CreateRenderer is not NULL");
+   if (sw == NULL) {
+      SDL_DestroyWindow(win);
+      SDL_free(coverage);
+      return TEST_ABORTED;
+   }
+   ret = SDL_SetWindowFrameCallback(win, _recordPresentedRects, coverage);
+   SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetWindowFrameCallback, expected: 0, got: %i", ret);
+
+   SDL_memset(pixels, 0xFF, sizeof (pixels));
+   sprite = SDL_CreateTexture(sw, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 8, 8);
+   SDLTest_AssertCheck(sprite != NULL, "Verify result from SDL_CreateTexture is not NULL");
+   SDL_UpdateTexture(sprite, NULL, pixels, 8 * sizeof (Uint32));
+
+   /* A clear presents the whole window */
+   SDL_SetRenderDrawColor(sw, 0, 0, 0, SDL_ALPHA_OPAQUE);
+   SDL_RenderClear(sw);
+   SDL_RenderPresent(sw);
+   SDLTest_AssertCheck(_countUnpresented(coverage, &full) == 0, "Validate a clear presents the whole window");
+
+   /* Draw the sprite */
+   SDL_memset(coverage->covered, 0, sizeof (coverage->covered));
+   oldpos.x = 5;
+   oldpos.y = 7;
+   oldpos.w = oldpos.h = 8;
+   SDL_RenderCopy(sw, sprite, NULL, &oldpos);
+   SDL_RenderPresent(sw);
+   SDLTest_AssertCheck(_countUnpresented(coverage, &oldpos) == 0, "Validate the sprite was presented");
+   SDLTest_AssertCheck(_countUnpresented(coverage, &full) > 0, "Validate only part of the window was presented");
+
+   /* Move it: erase the old position and draw at the new one */
+   SDL_memset(coverage->covered, 0, sizeof (coverage->covered));
+   newpos.x = 40;
+   newpos.y = 30;
+   newpos.w = newpos.h = 8;
+   SDL_RenderFillRect(sw, &oldpos);
+   SDL_RenderCopy(sw, sprite, NULL, &newpos);
+   SDL_RenderPresent(sw);
+   SDLTest_AssertCheck(_countUnpresented(coverage, &oldpos) == 0, "Validate the old sprite position was presented");
+   SDLTest_AssertCheck(_countUnpresented(coverage, &newpos) == 0, "Validate the new sprite position was presented");
+   SDLTest_AssertCheck(_countUnpresented(coverage, &full) > 0, "Validate only part of the window was presented");
+
+   /* Nothing drawn, nothing presented */
+   coverage->frames = 0;
+   SDL_RenderPresent(sw);
+   SDLTest_AssertCheck(coverage->frames == 0, "Validate an empty frame isn't presented, expected: 0, got: %i", coverage->frames);
+
+   /* The window contents can be lost when it's exposed or resized */
+   SDL_memset(coverage->covered, 0, sizeof (coverage->covered));
+   SDL_zero(event);
+   event.type = SDL_WINDOWEVENT;
+   event.window.event = SDL_WINDOWEVENT_EXPOSED;
+   event.window.windowID = SDL_GetWindowID(win);
+   SDL_PushEvent(&event);
+   SDL_RenderCopy(sw, sprite, NULL, &newpos);
+   SDL_RenderPresent(sw);
+   SDLTest_AssertCheck(_countUnpresented(coverage, &full) == 0, "Validate an exposed window is presented whole");
+
+   SDL_memset(coverage->covered, 0, sizeof (coverage->covered));
+   event.window.event = SDL_WINDOWEVENT_SIZE_CHANGED;
+   event.window.data1 = coverage->w;
+   event.window.data2 = coverage->h;
+   SDL_PushEvent(&event);
+   SDL_RenderCopy(sw, sprite, NULL, &newpos);
+   SDL_RenderPresent(sw);
+   SDLTest_AssertCheck(_countUnpresented(coverage, &full) == 0, "Validate a resized window is presented whole");
+
+   SDL_FlushEvent(SDL_WINDOWEVENT);
+   SDL_DestroyTexture(sprite);
+   SDL_DestroyRenderer(sw);
+   SDL_DestroyWindow(win);
+   SDL_free(coverage);
+
+   return TEST_COMPLETED;
+}
+
+
+/**
+ * @brief Draws a scene mixing copies, geometry and blended fills, crossing tile boundaries. Helper function.
+ */
+static int
+_drawMixedScene(SDL_Renderer *target)
+{
+   int ret = 0;
+   int i;
+   SDL_Rect rect;
+   SDL_Point points[8];
+   SDL_Texture *texture;
+   SDL_Vertex verts[6];
+   Uint32 pixels[16 * 16];
+   const int indices[6] = { 0, 1, 2, 3, 4, 5 };
+
+   for (i = 0; i < SDL_arraysize(pixels); i++) {
+      pixels[i] = ((Uint32) (i * 15) << 24) | ((Uint32) (i * 7) << 16) | ((Uint32) (255 - i) << 8) | (Uint32) (i * 3);
+   }
+   texture = SDL_CreateTexture(target, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, 16, 16);
+   if (texture == NULL) {
+      return -1;
+   }
+   ret |= SDL_UpdateTexture(texture, NULL, pixels, 16 * sizeof (Uint32));
+
+   ret |= SDL_SetRenderDrawColor(target, 20, 40, 60, SDL_ALPHA_OPAQUE);
+   ret |= SDL_RenderClear(target);
+
+   /* Blended fills straddling the 64 pixel tiles */
+   ret |= SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 6; i++) {
+      ret |= SDL_SetRenderDrawColor(target, (Uint8) (40 * i), 200, (Uint8) (255 - 30 * i), (Uint8) (60 + 30 * i));
+      rect.x = 20 + i * 25;
+      rect.y = 10 + i * 17;
+      rect.w = 70;
+      rect.h = 45;
+      ret |= SDL_RenderFillRect(target, &rect);
+   }
+   ret |= SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_ADD);
+   ret |= SDL_SetRenderDrawColor(target, 90, 10, 10, 128);
+   rect.x = 50;
+   rect.y = 50;
+   rect.w = 100;
+   rect.h = 60;
+   ret |= SDL_RenderFillRect(target, &rect);
+   ret |= SDL_SetRenderDrawBlendMode(target, SDL_BLENDMODE_NONE);
+
+   /* Points and lines in between */
+   for (i = 0; i < SDL_arraysize(points); i++) {
+      points[i].x = 5 + i * 23;
+      points[i].y = 140 - i * 9;
+   }
+   ret |= SDL_SetRenderDrawColor(target, 255, 255, 0, SDL_ALPHA_OPAQUE);
+   ret |= SDL_RenderDrawPoints(target, points, SDL_arraysize(points));
+   ret |= SDL_RenderDrawLines(target, points, SDL_arraysize(points));
+
+   /* Unscaled, scaled and rotated copies, blended and modulated */
+   ret |= SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 8; i++) {
+      rect.x = 56 + i * 9;
+      rect.y = 56 + (i & 3) * 5;
+      rect.w = 16;
+      rect.h = 16;
+      ret |= SDL_SetTextureColorMod(texture, 255, (Uint8) (255 - i * 20), (Uint8) (i * 30));
+      ret |= SDL_SetTextureAlphaMod(texture, (Uint8) (255 - i * 10));
+      ret |= SDL_RenderCopy(target, texture, NULL, &rect);
+   }
+   ret |= SDL_SetTextureColorMod(texture, 255, 255, 255);
+   ret |= SDL_SetTextureAlphaMod(texture, 255);
+   rect.x = 100;
+   rect.y = 40;
+   rect.w = 70;
+   rect.h = 50;
+   ret |= SDL_RenderCopy(target, texture, NULL, &rect);
+   rect.x = 30;
+   rect.y = 90;
+   ret |= SDL_RenderCopyEx(target, texture, NULL, &rect, 30.0, NULL, SDL_FLIP_HORIZONTAL);
+
+   /* Textured and colored triangles across several tiles */
+   for (i = 0; i < 6; i++) {
+      verts[i].color.r = (Uint8) (50 * i);
+      verts[i].color.g = 255;
+      verts[i].color.b = (Uint8) (255 - 50 * i);
+      verts[i].color.a = (Uint8) (100 + 30 * i);
+      verts[i].tex_coord.x = (i & 1) ? 1.0f : 0.0f;
+      verts[i].tex_coord.y = (i & 2) ? 1.0f : 0.0f;
+   }
+   verts[0].position.x = 10.0f; verts[0].position.y = 120.0f;
+   verts[1].position.x = 190.0f; verts[1].position.y = 70.0f;
+   verts[2].position.x = 60.0f; verts[2].position.y = 5.0f;
+   verts[3].position.x = 130.5f; verts[3].position.y = 145.25f;
+   verts[4].position.x = 63.75f; verts[4].position.y = 66.0f;
+   verts[5].position.x = 199.0f; verts[5].position.y = 120.0f;
+   ret |= SDL_RenderGeometry(target, texture, verts, 3, indices, 3);
+   ret |= SDL_RenderGeometry(target, NULL, verts + 3, 3, indices, 3);
+
+   SDL_DestroyTexture(texture);
+   return ret;
+}
+
+/**
+ * @brief Tests that the software renderer draws the same with and without threads.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_SW_THREADS
+ */
+int
+render_testSoftwareThreads(void *arg)
+{
+   const int w = 200, h = 150;
+   const char *counts[] = { "0", "2", "4" };
+   Uint32 *pixels[SDL_arraysize(counts)];
+   char *hint;
+   int ret;
+   int i;
+
+   hint = SDL_GetHint(SDL_HINT_RENDER_SW_THREADS) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_SW_THREADS)) : NULL;
+   SDL_zero(pixels);
+
+   for (i = 0; i < SDL_arraysize(counts); i++) {
+      SDL_Surface *surface;
+      SDL_Renderer *target;
+
+      SDL_SetHint(SDL_HINT_RENDER_SW_THREADS, counts[i]);
+      surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+      SDLTest_AssertCheck(surface != NULL, "Verify result from SDL_CreateRGBSurfaceWithFormat is not NULL");
+      if (surface == NULL) {
+         break;
+      }
+      target = SDL_CreateSoftwareRenderer(surface);
+      SDLTest_AssertCheck(target != NULL, "Verify result from SDL_CreateSoftwareRenderer with %s threads is not NULL", counts[i]);
+      if (target == NULL) {
+         SDL_FreeSurface(surface);
+         break;
+      }
+
+      ret = _drawMixedScene(target);
+      SDLTest_AssertCheck(ret == 0, "Validate drawing the scene with %s threads, expected: 0, got: %i", counts[i], ret);
+
+      pixels[i] = (Uint32 *) SDL_malloc(w * h * sizeof (Uint32));
+      if (pixels[i] != NULL) {
+         ret = SDL_RenderReadPixels(target, NULL, SDL_PIXELFORMAT_ARGB8888, pixels[i], w * sizeof (Uint32));
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+      }
+      SDL_DestroyRenderer(target);
+      SDL_FreeSurface(surface);
+   }
+
+   for (i = 1; i < SDL_arraysize(counts); i++) {
+      if (pixels[0] != NULL && pixels[i] != NULL) {
+         ret = SDL_memcmp(pixels[0], pixels[i], w * h * sizeof (Uint32));
+         SDLTest_AssertCheck(ret == 0, "Validate output with %s threads matches serial output", counts[i]);
+      }
+   }
+   for (i = 0; i < SDL_arraysize(counts); i++) {
+      SDL_free(pixels[i]);
+   }
+
+   SDL_SetHint(SDL_HINT_RENDER_SW_THREADS, hint);
+   SDL_free(hint);
+
+   return TEST_COMPLETED;
+}
+
+
 /**
  * @brief Blits doing color tests.
  *
@@ -1085,9 +1959,33 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        { (SDLTest_TestCaseFp)render_testGeometry, "render_testGeometry", "Tests rendering triangles with SDL_RenderGeometry", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest9 =
+        { (SDLTest_TestCaseFp)render_testRenderStats, "render_testRenderStats", "Tests the per frame renderer statistics", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest10 =
+        { (SDLTest_TestCaseFp)render_testCommandList, "render_testCommandList", "Tests recording and replaying command lists", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest11 =
+        { (SDLTest_TestCaseFp)render_testCopyBatch, "render_testCopyBatch", "Tests copying an array of texture rectangles", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest12 =
+        { (SDLTest_TestCaseFp)render_testScaleQuality, "render_testScaleQuality", "Tests scaling textures with nearest and linear filtering", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest13 =
+        { (SDLTest_TestCaseFp)render_testCapture, "render_testCapture", "Tests capturing presented frames to a stream", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest14 =
+        { (SDLTest_TestCaseFp)render_testSoftwareThreads, "render_testSoftwareThreads", "Tests threaded software rendering against serial rendering", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference renderTest15 =
+        { (SDLTest_TestCaseFp)render_testPresentDamage, "render_testPresentDamage", "Tests that the software renderer presents the areas it drew to", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10, &renderTest11, &renderTest12, &renderTest13, &renderTest14, &renderTest15, NULL
 };
 
 /* Render test suite (global) */
@@ -588,6 +588,778 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/**
+ * @brief Tests that blits split across threads match blits on one thread.
+ */
+int
+surface_testThreadedBlit(void *arg)
+{
+    SDL_Surface *face, *serial[3], *threaded[3];
+    SDL_Rect rect;
+    int i, pass, ret;
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify face surface is not NULL");
+    if (face == NULL) {
+        return TEST_ABORTED;
+    }
+
+    for (pass = 0; pass < 2; pass++) {
+        SDL_Surface **result = pass ? threaded : serial;
+
+        SDL_SetHint(SDL_HINT_BLIT_THREADS, pass ? "4" : "1");
+        SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "1");
+
+        /* Conversion */
+        result[0] = SDL_ConvertSurface(face, testSurface->format, 0);
+        SDLTest_AssertCheck(result[0] != NULL, "Verify result from SDL_ConvertSurface is not NULL");
+
+        /* Blended blit */
+        result[1] = SDL_CreateRGBSurfaceWithFormat(0, testSurface->w, testSurface->h, 32, testSurface->format->format);
+        SDL_SetSurfaceBlendMode(face, SDL_BLENDMODE_BLEND);
+        rect.x = 3;
+        rect.y = 5;
+        rect.w = face->w;
+        rect.h = face->h;
+        ret = SDL_BlitSurface(face, NULL, result[1], &rect);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+        /* Stretched blit */
+        result[2] = SDL_CreateRGBSurfaceWithFormat(0, testSurface->w, testSurface->h, 32, face->format->format);
+        SDL_SetSurfaceBlendMode(face, SDL_BLENDMODE_NONE);
+        rect.x = 1;
+        rect.y = 2;
+        rect.w = testSurface->w - 5;
+        rect.h = testSurface->h - 3;
+        ret = SDL_BlitScaled(face, NULL, result[2], &rect);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitScaled, expected: 0, got: %i", ret);
+    }
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, "1");
+    SDL_SetHint(SDL_HINT_BLIT_THREAD_THRESHOLD, "");
+
+    for (i = 0; i < SDL_arraysize(serial); i++) {
+        ret = SDLTest_CompareSurfaces(threaded[i], serial[i], 0);
+        SDLTest_AssertCheck(ret == 0, "Validate result %d from SDLTest_CompareSurfaces, expected: 0, got: %i", i, ret);
+        SDL_FreeSurface(serial[i]);
+        SDL_FreeSurface(threaded[i]);
+    }
+    SDL_FreeSurface(face);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests blitting one surface alternately to several destinations.
+ */
+int
+surface_testAlternatingBlit(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ABGR8888,
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ABGR8888
+    };
+    SDL_Surface *face, *copy, *dst[SDL_arraysize(formats)], *expected;
+    SDL_Color colors[256];
+    int i, round, ret;
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify face surface is not NULL");
+    if (face == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceBlendMode(face, SDL_BLENDMODE_BLEND);
+
+    for (i = 0; i < 256; i++) {
+        colors[i].r = (Uint8)(i & 0xE0);
+        colors[i].g = (Uint8)((i << 3) & 0xE0);
+        colors[i].b = (Uint8)((i << 6) & 0xC0);
+        colors[i].a = 0xFF;
+    }
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        dst[i] = SDL_CreateRGBSurfaceWithFormat(0, face->w, face->h, 0, formats[i]);
+        SDLTest_AssertCheck(dst[i] != NULL, "Verify destination surface %d is not NULL", i);
+        if (dst[i] == NULL) {
+            return TEST_ABORTED;
+        }
+        if (dst[i]->format->palette) {
+            SDL_SetPaletteColors(dst[i]->format->palette, colors, 0, 256);
+        }
+    }
+
+    for (round = 0; round < 3; round++) {
+        if (round == 2) {
+            /* The cached mapping to the indexed surface is stale now */
+            colors[1].r = 0xFF;
+            SDL_SetPaletteColors(dst[2]->format->palette, colors, 0, 256);
+        }
+        for (i = 0; i < SDL_arraysize(formats); i++) {
+            SDL_FillRect(dst[i], NULL, 0);
+            ret = SDL_BlitSurface(face, NULL, dst[i], NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            /* Compare with a fresh copy of the source that was only ever mapped once */
+            copy = SDL_ConvertSurface(face, face->format, 0);
+            SDLTest_AssertCheck(copy != NULL, "Verify result from SDL_ConvertSurface is not NULL");
+            SDL_SetSurfaceBlendMode(copy, SDL_BLENDMODE_BLEND);
+            expected = SDL_ConvertSurface(dst[i], dst[i]->format, 0);
+            SDLTest_AssertCheck(expected != NULL, "Verify result from SDL_ConvertSurface is not NULL");
+            SDL_FillRect(expected, NULL, 0);
+            SDL_BlitSurface(copy, NULL, expected, NULL);
+
+            ret = SDLTest_CompareSurfaces(dst[i], expected, 0);
+            SDLTest_AssertCheck(ret == 0, "Validate destination %d in round %d, expected: 0, got: %i", i, round, ret);
+            SDL_FreeSurface(expected);
+            SDL_FreeSurface(copy);
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        SDL_FreeSurface(dst[i]);
+    }
+    SDL_FreeSurface(face);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_ConvertPixels() between the 24 and 32-bit RGB orderings.
+ */
+int
+surface_testConvertPixelsRGB(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_BGR24,
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+        SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGRX8888,
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    /* Odd widths leave pixels over after the SIMD paths */
+    const int width = 37, height = 3;
+    const int pitch = width * 4;
+    Uint32 original[37 * 3], result[37 * 3];
+    Uint8 converted[37 * 3 * 4];
+    int i, j, ret;
+
+    for (i = 0; i < SDL_arraysize(original); i++) {
+        original[i] = (Uint32) SDLTest_RandomUint32();
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        ret = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, original, pitch, formats[i], converted, pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels to %s, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+        ret = SDL_ConvertPixels(width, height, formats[i], converted, pitch, SDL_PIXELFORMAT_ARGB8888, result, pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_ConvertPixels from %s, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+
+        for (j = 0; j < SDL_arraysize(original); j++) {
+            Uint32 expected = original[j];
+            if (!SDL_ISPIXELFORMAT_ALPHA(formats[i])) {
+                expected |= 0xFF000000;
+            }
+            if (result[j] != expected) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(j == SDL_arraysize(original), "Verify pixels round trip through %s", SDL_GetPixelFormatName(formats[i]));
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests SDL_FillRects() against filling the same rects one at a time.
+ */
+int
+surface_testFillRects(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888
+    };
+    /* Adjacent, overlapping, partly clipped and empty rects */
+    static const SDL_Rect rects[] = {
+        { 0, 0, 10, 10 }, { 10, 0, 10, 10 }, { 0, 10, 20, 5 }, { 5, 5, 3, 3 },
+        { 30, 7, 151, 40 }, { 60, 47, 121, 2 }, { 300, 40, 10, 10 },
+        { -5, 60, 20, 20 }, { 3, 90, 0, 5 }, { 7, 200, 5, 5 }
+    };
+    SDL_Surface *surface, *expected;
+    Uint32 color;
+    int i, j, ret;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, 317, 101, 0, formats[i]);
+        expected = SDL_CreateRGBSurfaceWithFormat(0, 317, 101, 0, formats[i]);
+        SDLTest_AssertCheck(surface != NULL && expected != NULL, "Verify %s surfaces are not NULL", SDL_GetPixelFormatName(formats[i]));
+        if (surface == NULL || expected == NULL) {
+            return TEST_ABORTED;
+        }
+        color = SDLTest_RandomUint32();
+        if (surface->format->BitsPerPixel < 32) {
+            color &= (1u << surface->format->BitsPerPixel) - 1;
+        }
+
+        ret = SDL_FillRects(surface, rects, SDL_arraysize(rects), color);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_FillRects, expected: 0, got: %i", ret);
+        for (j = 0; j < SDL_arraysize(rects); j++) {
+            SDL_FillRect(expected, &rects[j], color);
+        }
+
+        ret = SDL_memcmp(surface->pixels, expected->pixels, surface->pitch * surface->h);
+        SDLTest_AssertCheck(ret == 0, "Verify %s pixels match, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+
+        SDL_FreeSurface(surface);
+        SDL_FreeSurface(expected);
+    }
+
+    SDL_ClearError();
+    ret = SDL_FillRects(NULL, rects, SDL_arraysize(rects), 0);
+    SDLTest_AssertCheck(ret == -1, "Verify result from SDL_FillRects(NULL, ...), expected: -1, got: %i", ret);
+    SDLTest_AssertCheck(*SDL_GetError() != '\0', "Verify SDL_FillRects(NULL, ...) sets an error");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests premultiplied alpha blending against straight alpha blending.
+ */
+int
+surface_testBlitBlendPremultiplied(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888
+    };
+    static const Uint8 alphamods[] = { 255, 128 };
+    SDL_Surface *src, *premultiplied, *expected, *actual;
+    SDL_BlendMode blendMode;
+    Uint32 *pixel;
+    Uint8 e[4], a[4];
+    int i, j, k, x, ret, maxdiff;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 67, 13, 0, SDL_PIXELFORMAT_ARGB8888);
+    premultiplied = SDL_CreateRGBSurfaceWithFormat(0, 67, 13, 0, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(src != NULL && premultiplied != NULL, "Verify source surfaces are not NULL");
+    if (src == NULL || premultiplied == NULL) {
+        return TEST_ABORTED;
+    }
+    pixel = (Uint32 *) src->pixels;
+    for (x = 0; x < src->w * src->h; x++) {
+        pixel[x] = SDLTest_RandomUint32();
+    }
+    pixel[0] = 0x80FF4000;
+
+    ret = SDL_PremultiplyAlpha(src->w, src->h, src->format->format, src->pixels, src->pitch,
+                               premultiplied->format->format, premultiplied->pixels, premultiplied->pitch);
+    SDLTest_AssertPass("Call to SDL_PremultiplyAlpha()");
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplyAlpha, expected: 0, got: %i", ret);
+    pixel = (Uint32 *) premultiplied->pixels;
+    SDLTest_AssertCheck(pixel[0] == 0x80002080, "Verify premultiplied pixel, expected: 0x80002080, got: 0x%.8x", pixel[0]);
+
+    ret = SDL_PremultiplyAlpha(1, 1, SDL_PIXELFORMAT_ARGB8888, src->pixels, src->pitch,
+                               SDL_PIXELFORMAT_RGB565, premultiplied->pixels, premultiplied->pitch);
+    SDLTest_AssertCheck(ret == -1, "Verify SDL_PremultiplyAlpha rejects formats without alpha, expected: -1, got: %i", ret);
+
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    ret = SDL_SetSurfaceBlendMode(premultiplied, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+    SDL_GetSurfaceBlendMode(premultiplied, &blendMode);
+    SDLTest_AssertCheck(blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED, "Verify blend mode, expected: %i, got: %i", SDL_BLENDMODE_BLEND_PREMULTIPLIED, blendMode);
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        for (j = 0; j < SDL_arraysize(alphamods); j++) {
+            expected = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 0, formats[i]);
+            actual = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 0, formats[i]);
+            SDLTest_AssertCheck(expected != NULL && actual != NULL, "Verify %s surfaces are not NULL", SDL_GetPixelFormatName(formats[i]));
+            if (expected == NULL || actual == NULL) {
+                return TEST_ABORTED;
+            }
+            pixel = (Uint32 *) expected->pixels;
+            for (x = 0; x < expected->w * expected->h; x++) {
+                pixel[x] = SDLTest_RandomUint32();
+            }
+            SDL_memcpy(actual->pixels, expected->pixels, expected->pitch * expected->h);
+
+            SDL_SetSurfaceAlphaMod(src, alphamods[j]);
+            SDL_SetSurfaceAlphaMod(premultiplied, alphamods[j]);
+            ret = SDL_BlitSurface(src, NULL, expected, NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+            ret = SDL_BlitSurface(premultiplied, NULL, actual, NULL);
+            SDLTest_AssertCheck(ret == 0, "Verify result from SDL_BlitSurface, expected: 0, got: %i", ret);
+
+            /* Premultiplying rounds while blending truncates, so allow small differences */
+            maxdiff = 0;
+            for (k = 0; k < expected->w * expected->h; k++) {
+                SDL_GetRGBA(((Uint32 *) expected->pixels)[k], expected->format, &e[0], &e[1], &e[2], &e[3]);
+                SDL_GetRGBA(((Uint32 *) actual->pixels)[k], actual->format, &a[0], &a[1], &a[2], &a[3]);
+                for (x = 0; x < 4; x++) {
+                    maxdiff = SDL_max(maxdiff, SDL_abs(e[x] - a[x]));
+                }
+            }
+            SDLTest_AssertCheck(maxdiff <= 2, "Verify %s pixels with alpha mod %d, expected difference <= 2, got: %i",
+                                SDL_GetPixelFormatName(formats[i]), alphamods[j], maxdiff);
+
+            SDL_FreeSurface(expected);
+            SDL_FreeSurface(actual);
+        }
+    }
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(premultiplied);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests loading memory mapped bitmaps, in place and converted.
+ */
+int
+surface_testLoadMappedBitmap(void *arg)
+{
+    const char *sampleFilename = "testLoadMappedBitmap.bmp";
+    SDL_Surface *face, *bgr, *rface, *mface, *expected, *actual;
+    SDL_RWops *rw;
+    int ret;
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Verify face surface is not NULL");
+    if (face == NULL) return TEST_ABORTED;
+
+    /* Bottom-up files get converted from the mapping */
+    unlink(sampleFilename);
+    ret = SDL_SaveBMP(face, sampleFilename);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SaveBMP, expected: 0, got: %i", ret);
+    rface = SDL_LoadBMP(sampleFilename);
+    mface = SDL_LoadBMP_Mapped(sampleFilename);
+    SDLTest_AssertPass("Call to SDL_LoadBMP_Mapped()");
+    SDLTest_AssertCheck(rface != NULL && mface != NULL, "Verify loaded surfaces are not NULL");
+    if (rface != NULL && mface != NULL) {
+        SDLTest_AssertCheck(!(mface->flags & SDL_MAPPED), "Verify bottom-up surface does not use the mapping");
+        expected = SDL_ConvertSurfaceFormat(rface, SDL_PIXELFORMAT_ARGB8888, 0);
+        actual = SDL_ConvertSurfaceFormat(mface, SDL_PIXELFORMAT_ARGB8888, 0);
+        ret = SDL_memcmp(expected->pixels, actual->pixels, expected->pitch * expected->h);
+        SDLTest_AssertCheck(ret == 0, "Verify bottom-up pixels match, expected: 0, got: %i", ret);
+        SDL_FreeSurface(expected);
+        SDL_FreeSurface(actual);
+    }
+    SDL_FreeSurface(rface);
+    SDL_FreeSurface(mface);
+
+    /* Top-down 24-bit files can be used in place */
+    bgr = SDL_ConvertSurfaceFormat(face, SDL_PIXELFORMAT_BGR24, 0);
+    SDLTest_AssertCheck(bgr != NULL, "Verify converted surface is not NULL");
+    if (bgr == NULL) return TEST_ABORTED;
+    rw = SDL_RWFromFile(sampleFilename, "wb");
+    SDLTest_AssertCheck(rw != NULL, "Verify result from SDL_RWFromFile is not NULL");
+    if (rw == NULL) return TEST_ABORTED;
+    SDL_RWwrite(rw, "BM", 2, 1);
+    SDL_WriteLE32(rw, 54 + bgr->pitch * bgr->h);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 54);
+    SDL_WriteLE32(rw, 40);
+    SDL_WriteLE32(rw, bgr->w);
+    SDL_WriteLE32(rw, (Uint32) -bgr->h);
+    SDL_WriteLE16(rw, 1);
+    SDL_WriteLE16(rw, 24);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, bgr->pitch * bgr->h);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 0);
+    SDL_WriteLE32(rw, 0);
+    SDL_RWwrite(rw, bgr->pixels, bgr->pitch, bgr->h);
+    SDL_RWclose(rw);
+
+    mface = SDL_LoadBMP_Mapped(sampleFilename);
+    SDLTest_AssertCheck(mface != NULL, "Verify result from SDL_LoadBMP_Mapped is not NULL");
+    if (mface != NULL) {
+#if defined(__LINUX__) || defined(__MACOSX__) || (defined(__WIN32__) && !defined(__WINRT__))
+        SDLTest_AssertCheck((mface->flags & SDL_MAPPED) != 0, "Verify top-down surface uses the mapping");
+#endif
+        SDLTest_AssertCheck(mface->format->format == bgr->format->format, "Verify format, expected: %s, got: %s",
+                            SDL_GetPixelFormatName(bgr->format->format), SDL_GetPixelFormatName(mface->format->format));
+        SDLTest_AssertCheck(mface->pitch == bgr->pitch, "Verify pitch, expected: %i, got: %i", bgr->pitch, mface->pitch);
+        ret = SDL_memcmp(mface->pixels, bgr->pixels, bgr->pitch * bgr->h);
+        SDLTest_AssertCheck(ret == 0, "Verify top-down pixels match, expected: 0, got: %i", ret);
+
+        /* Changes to the pixels stay out of the file */
+        SDL_FillRect(mface, NULL, 0);
+        SDL_FreeSurface(mface);
+        rface = SDL_LoadBMP(sampleFilename);
+        SDLTest_AssertCheck(rface != NULL, "Verify result from SDL_LoadBMP is not NULL");
+        if (rface != NULL) {
+            ret = SDL_memcmp(rface->pixels, bgr->pixels, bgr->pitch * bgr->h);
+            SDLTest_AssertCheck(ret == 0, "Verify file is unchanged, expected: 0, got: %i", ret);
+            SDL_FreeSurface(rface);
+        }
+    }
+
+    unlink(sampleFilename);
+    SDL_FreeSurface(bgr);
+    SDL_FreeSurface(face);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests recycling surfaces through the surface pool.
+ */
+int
+surface_testSurfacePool(void *arg)
+{
+    SDL_SurfacePoolStats stats, before;
+    SDL_Surface *surface, *recycled;
+    SDL_BlendMode blendMode;
+    SDL_Rect clip;
+    Uint8 r, g, b;
+    size_t max_bytes;
+    int i, nonzero;
+
+    /* Start from an empty pool */
+    SDL_GetSurfacePoolStats(&stats);
+    max_bytes = stats.max_bytes;
+    SDL_SetSurfacePoolSize(0);
+    SDL_SetSurfacePoolSize(1024 * 1024);
+    SDL_GetSurfacePoolStats(&before);
+    SDLTest_AssertCheck(before.surfaces == 0 && before.bytes == 0, "Verify pool is empty, got: %i surfaces, %i bytes",
+                        before.surfaces, (int) before.bytes);
+    SDLTest_AssertCheck(before.max_bytes == 1024 * 1024, "Verify pool size, expected: %i, got: %i",
+                        1024 * 1024, (int) before.max_bytes);
+
+    surface = SDL_CreateRGBSurfaceWithFormat(SDL_POOLED, 37, 23, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify pooled surface is not NULL");
+    if (surface == NULL) return TEST_ABORTED;
+    SDLTest_AssertCheck((surface->flags & SDL_POOLED) != 0, "Verify surface has the SDL_POOLED flag");
+
+    /* Change everything that a new surface has to get back */
+    SDL_FillRect(surface, NULL, 0x12345678);
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_ADD);
+    SDL_SetSurfaceColorMod(surface, 1, 2, 3);
+    SDL_SetColorKey(surface, SDL_TRUE, 0x12345678);
+    clip.x = clip.y = 1;
+    clip.w = clip.h = 2;
+    SDL_SetClipRect(surface, &clip);
+    surface->h -= 3;
+    SDL_FreeSurface(surface);
+
+    SDL_GetSurfacePoolStats(&stats);
+    SDLTest_AssertCheck(stats.surfaces == 1, "Verify freed surface is pooled, expected: 1, got: %i", stats.surfaces);
+    SDLTest_AssertCheck(stats.bytes == (size_t) 37 * 4 * 23, "Verify pooled bytes, expected: %i, got: %i",
+                        37 * 4 * 23, (int) stats.bytes);
+
+    /* A different size or format doesn't match */
+    recycled = SDL_CreateRGBSurfaceWithFormat(SDL_POOLED, 37, 23, 32, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(recycled != NULL && recycled != surface, "Verify other format gets a new surface");
+    SDL_FreeSurface(recycled);
+
+    recycled = SDL_CreateRGBSurfaceWithFormat(SDL_POOLED, 37, 23, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(recycled == surface, "Verify surface was recycled");
+    if (recycled == NULL) return TEST_ABORTED;
+    SDL_GetSurfacePoolStats(&stats);
+    SDLTest_AssertCheck(stats.hits == before.hits + 1, "Verify pool hits, expected: %i, got: %i",
+                        (int) before.hits + 1, (int) stats.hits);
+    SDLTest_AssertCheck(stats.misses == before.misses + 2, "Verify pool misses, expected: %i, got: %i",
+                        (int) before.misses + 2, (int) stats.misses);
+
+    SDLTest_AssertCheck(recycled->w == 37 && recycled->h == 23, "Verify size, expected: 37x23, got: %ix%i",
+                        recycled->w, recycled->h);
+    SDL_GetSurfaceBlendMode(recycled, &blendMode);
+    SDLTest_AssertCheck(blendMode == SDL_BLENDMODE_BLEND, "Verify blend mode was reset, got: %i", (int) blendMode);
+    SDL_GetSurfaceColorMod(recycled, &r, &g, &b);
+    SDLTest_AssertCheck(r == 255 && g == 255 && b == 255, "Verify color mod was reset, got: %i,%i,%i", r, g, b);
+    SDLTest_AssertCheck(!SDL_HasColorKey(recycled), "Verify color key was reset");
+    SDL_GetClipRect(recycled, &clip);
+    SDLTest_AssertCheck(clip.x == 0 && clip.y == 0 && clip.w == 37 && clip.h == 23, "Verify clip rect was reset");
+    nonzero = 0;
+    for (i = 0; i < recycled->pitch * recycled->h; ++i) {
+        nonzero += (((Uint8 *) recycled->pixels)[i] != 0);
+    }
+    SDLTest_AssertCheck(nonzero == 0, "Verify pixels were cleared, expected: 0, got: %i", nonzero);
+    SDL_FreeSurface(recycled);
+
+    /* Converted surfaces are only pooled when asked for */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 37, 23, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (surface == NULL) return TEST_ABORTED;
+    SDLTest_AssertCheck((surface->flags & SDL_POOLED) == 0, "Verify surface doesn't have the SDL_POOLED flag");
+    recycled = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+    SDLTest_AssertCheck(recycled != NULL && (recycled->flags & SDL_POOLED) == 0, "Verify converted surface doesn't have the SDL_POOLED flag");
+    SDL_FreeSurface(recycled);
+    recycled = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, SDL_POOLED);
+    SDLTest_AssertCheck(recycled != NULL && (recycled->flags & SDL_POOLED) != 0, "Verify converted surface has the SDL_POOLED flag");
+    SDL_FreeSurface(recycled);
+    SDL_FreeSurface(surface);
+
+    /* Surfaces that don't fit in the pool get freed */
+    surface = SDL_CreateRGBSurfaceWithFormat(SDL_POOLED, 1024, 1024, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify large pooled surface is not NULL");
+    SDL_FreeSurface(surface);
+    SDL_GetSurfacePoolStats(&stats);
+    SDLTest_AssertCheck(stats.surfaces == 2, "Verify large surface isn't pooled, expected: 2, got: %i", stats.surfaces);
+
+    SDL_SetSurfacePoolSize(0);
+    SDL_GetSurfacePoolStats(&stats);
+    SDLTest_AssertCheck(stats.surfaces == 0 && stats.bytes == 0, "Verify pool was emptied, got: %i surfaces, %i bytes",
+                        stats.surfaces, (int) stats.bytes);
+    SDLTest_AssertCheck(stats.evictions == before.evictions + 2, "Verify pool evictions, expected: %i, got: %i",
+                        (int) before.evictions + 2, (int) stats.evictions);
+
+    SDL_SetSurfacePoolSize(max_bytes);
+
+    return TEST_COMPLETED;
+}
+
+/* A blit to run once with the C blitters and once with the SIMD ones */
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    SDL_BlendMode blend;
+    Uint8 alpha;            /* alpha mod */
+    Uint8 r, g, b;          /* color mod */
+    SDL_bool scaled;
+} _SIMDBlitCase;
+
+/* Fills a surface with noise, with runs of transparent and opaque bytes */
+static void
+_fillNoise(SDL_Surface *surface, Uint32 seed)
+{
+    int x, y;
+
+    for (y = 0; y < surface->h; y++) {
+        Uint8 *row = (Uint8 *) surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->w * surface->format->BytesPerPixel; x++) {
+            seed = seed * 1103515245 + 12345;
+            switch ((seed >> 28) & 7) {
+            case 0:
+                row[x] = 0x00;
+                break;
+            case 1:
+                row[x] = 0xFF;
+                break;
+            default:
+                row[x] = (Uint8) (seed >> 16);
+                break;
+            }
+        }
+    }
+}
+
+/* Runs a blit with the blitters limited to the CPU features in features, and returns the destination */
+static SDL_Surface *
+_blitWithCPUFeatures(const _SIMDBlitCase *test, int w, int h, const char *features)
+{
+    SDL_Surface *src, *dst;
+    SDL_Rect rect;
+    int ret;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, test->src_format);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, w * 2 + 3, h * 2, 0, test->dst_format);
+    if (src == NULL || dst == NULL) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        return NULL;
+    }
+    _fillNoise(src, 1);
+    _fillNoise(dst, 2);
+    SDL_SetSurfaceBlendMode(src, test->blend);
+    SDL_SetSurfaceAlphaMod(src, test->alpha);
+    SDL_SetSurfaceColorMod(src, test->r, test->g, test->b);
+
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", features, 1);
+    rect.x = 1;
+    rect.y = 1;
+    if (test->scaled) {
+        rect.w = w * 2 - 1;
+        rect.h = h + h / 2;
+        ret = SDL_BlitScaled(src, NULL, dst, &rect);
+    } else {
+        ret = SDL_BlitSurface(src, NULL, dst, &rect);
+    }
+    SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+    /* Every feature the CPU has */
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", "4294967295", 1);
+
+    SDL_FreeSurface(src);
+    return dst;
+}
+
+/* Checks that the SIMD blitters give the same result as the C ones for odd widths */
+static void
+_compareSIMDBlits(const _SIMDBlitCase *tests, int numtests)
+{
+    static const int widths[] = { 1, 3, 7, 15, 17, 33, 67 };
+    /* SDL_BLIT_CPU_FEATURES masks: everything, and SSE to SSE4.1 without AVX2.
+       The older MMX alpha blitters round differently, so they're left out. */
+    static const char *features[] = { "4294967295", "268" };
+    int i, j, k, ret;
+
+    for (i = 0; i < numtests; i++) {
+        for (j = 0; j < SDL_arraysize(widths); j++) {
+            SDL_Surface *reference = _blitWithCPUFeatures(&tests[i], widths[j], 5, "0");
+
+            SDLTest_AssertCheck(reference != NULL, "Verify reference blit surface is not NULL");
+            if (reference == NULL) {
+                continue;
+            }
+            for (k = 0; k < SDL_arraysize(features); k++) {
+                SDL_Surface *result = _blitWithCPUFeatures(&tests[i], widths[j], 5, features[k]);
+
+                SDLTest_AssertCheck(result != NULL, "Verify blit surface is not NULL");
+                if (result != NULL) {
+                    ret = SDLTest_CompareSurfaces(result, reference, 0);
+                    SDLTest_AssertCheck(ret == 0, "Validate %s to %s, blend %d, alpha %d, color %d,%d,%d%s, width %d, features %s, expected: 0, got: %i",
+                                        SDL_GetPixelFormatName(tests[i].src_format), SDL_GetPixelFormatName(tests[i].dst_format),
+                                        (int) tests[i].blend, tests[i].alpha, tests[i].r, tests[i].g, tests[i].b,
+                                        tests[i].scaled ? ", scaled" : "", widths[j], features[k], ret);
+                }
+                SDL_FreeSurface(result);
+            }
+            SDL_FreeSurface(reference);
+        }
+    }
+}
+
+/**
+ * @brief Tests the SIMD alpha blending blitters against the C ones.
+ */
+int
+surface_testSIMDAlphaBlit(void *arg)
+{
+    static const _SIMDBlitCase tests[] = {
+        /* Per-pixel alpha */
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ABGR8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGBA8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGBX8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGRA8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_BGRX8888, SDL_BLENDMODE_BLEND, 255, 255, 255, 255, SDL_FALSE },
+        /* Per-surface alpha, including the 50% special case */
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, SDL_BLENDMODE_BLEND, 128, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, 77, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_BGR888, SDL_BLENDMODE_BLEND, 200, 255, 255, 255, SDL_FALSE },
+        { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ABGR8888, SDL_BLENDMODE_BLEND, 128, 255, 255, 255, SDL_FALSE }
+    };
+
+    _compareSIMDBlits(tests, SDL_arraysize(tests));
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests the SIMD automatic blitters against the C ones.
+ */
+int
+surface_testSIMDAutoBlit(void *arg)
+{
+    static const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888 },
+        { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888 },
+        { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_RGBA8888 }
+    };
+    static const SDL_BlendMode blends[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_BLEND_PREMULTIPLIED,
+        SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD
+    };
+    static const Uint8 mods[][4] = {
+        /* alpha, r, g, b */
+        { 255, 255, 255, 255 },
+        { 255, 200, 100, 3 },
+        { 130, 255, 255, 255 },
+        { 77, 10, 250, 128 }
+    };
+    _SIMDBlitCase tests[SDL_arraysize(blends) * SDL_arraysize(mods) * 2];
+    int i, j, k, n;
+
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        n = 0;
+        for (j = 0; j < SDL_arraysize(blends); j++) {
+            for (k = 0; k < (int) SDL_arraysize(mods) * 2; k++) {
+                tests[n].src_format = formats[i][0];
+                tests[n].dst_format = formats[i][1];
+                tests[n].blend = blends[j];
+                tests[n].alpha = mods[k / 2][0];
+                tests[n].r = mods[k / 2][1];
+                tests[n].g = mods[k / 2][2];
+                tests[n].b = mods[k / 2][3];
+                tests[n].scaled = (k & 1) ? SDL_TRUE : SDL_FALSE;
+                n++;
+            }
+        }
+        _compareSIMDBlits(tests, n);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that the SIMD copy blitters write the same bytes as the C ones, padding included.
+ */
+int
+surface_testSIMDSwizzleBlit(void *arg)
+{
+    static const Uint32 formats[][2] = {
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_BGRX8888 },
+        { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888 },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_BGR888 },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBX8888 },
+        { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGR24 },
+        { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB24 },
+        { SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ABGR8888 }
+    };
+    static const int widths[] = { 1, 3, 7, 15, 17, 33, 67 };
+    static const char *features[] = { "4294967295", "268" };
+    _SIMDBlitCase test;
+    int i, j, k, y;
+
+    test.blend = SDL_BLENDMODE_NONE;
+    test.alpha = 255;
+    test.r = test.g = test.b = 255;
+    test.scaled = SDL_FALSE;
+    for (i = 0; i < SDL_arraysize(formats); i++) {
+        test.src_format = formats[i][0];
+        test.dst_format = formats[i][1];
+        for (j = 0; j < SDL_arraysize(widths); j++) {
+            SDL_Surface *reference = _blitWithCPUFeatures(&test, widths[j], 5, "0");
+
+            SDLTest_AssertCheck(reference != NULL, "Verify reference blit surface is not NULL");
+            if (reference == NULL) {
+                continue;
+            }
+            for (k = 0; k < SDL_arraysize(features); k++) {
+                SDL_Surface *result = _blitWithCPUFeatures(&test, widths[j], 5, features[k]);
+                int diffs = 0;
+
+                SDLTest_AssertCheck(result != NULL, "Verify blit surface is not NULL");
+                if (result == NULL) {
+                    continue;
+                }
+                /* Compare whole rows, so a padding byte that isn't kept shows up */
+                for (y = 0; y < result->h; y++) {
+                    if (SDL_memcmp((Uint8 *) result->pixels + y * result->pitch,
+                                   (Uint8 *) reference->pixels + y * reference->pitch,
+                                   result->w * result->format->BytesPerPixel) != 0) {
+                        diffs++;
+                    }
+                }
+                SDLTest_AssertCheck(diffs == 0, "Validate %s to %s, width %d, features %s, expected: 0 differing rows, got: %i",
+                                    SDL_GetPixelFormatName(test.src_format), SDL_GetPixelFormatName(test.dst_format),
+                                    widths[j], features[k], diffs);
+                SDL_FreeSurface(result);
+            }
+            SDL_FreeSurface(reference);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -630,11 +1402,43 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testThreadedBlit, "surface_testThreadedBlit", "Tests blits split across threads.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testAlternatingBlit, "surface_testAlternatingBlit", "Tests blitting alternately to several destinations.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testConvertPixelsRGB, "surface_testConvertPixelsRGB", "Tests pixel conversion between RGB orderings.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest16 =
+        { (SDLTest_TestCaseFp)surface_testFillRects, "surface_testFillRects", "Tests filling several rects at once.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest17 =
+        { (SDLTest_TestCaseFp)surface_testBlitBlendPremultiplied, "surface_testBlitBlendPremultiplied", "Tests blitting routines with premultiplied blending mode.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest18 =
+        { (SDLTest_TestCaseFp)surface_testLoadMappedBitmap, "surface_testLoadMappedBitmap", "Tests loading memory mapped bitmaps.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest19 =
+        { (SDLTest_TestCaseFp)surface_testSurfacePool, "surface_testSurfacePool", "Tests recycling surfaces through the surface pool.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest20 =
+        { (SDLTest_TestCaseFp)surface_testSIMDAlphaBlit, "surface_testSIMDAlphaBlit", "Tests the SIMD alpha blending blitters against the C ones.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest21 =
+        { (SDLTest_TestCaseFp)surface_testSIMDAutoBlit, "surface_testSIMDAutoBlit", "Tests the SIMD automatic blitters against the C ones.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest22 =
+        { (SDLTest_TestCaseFp)surface_testSIMDSwizzleBlit, "surface_testSIMDSwizzleBlit", "Tests that the SIMD copy blitters write the same bytes as the C ones.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14,
+    &surfaceTest15, &surfaceTest16, &surfaceTest17,
+    &surfaceTest18, &surfaceTest19, &surfaceTest20, &surfaceTest21, &surfaceTest22, NULL
 };
 
 /* Surface test suite (global) */
@@ -16,6 +16,7 @@
 #endif
 
 #include "SDL.h"
+#include "SDL_syswm.h"
 #include "SDL_test.h"
 
 /* Private helpers */
@@ -1720,6 +1721,370 @@ video_getSetWindowData(void *arg)
   return returnValue;
 }
 
+static int _frameCallbackCount;
+static SDL_Rect _frameCallbackRect;
+
+static void SDLCALL
+_frameCallback(SDL_Window *window, SDL_Surface *frame, const SDL_Rect *rects, int numrects, void *data)
+{
+  ++_frameCallbackCount;
+  if (numrects > 0) {
+    _frameCallbackRect = rects[0];
+  }
+  *(SDL_Surface **)data = frame;
+}
+
+/**
+ * @brief Tests call to SDL_SetWindowFrameCallback
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_SetWindowFrameCallback
+ */
+int
+video_setWindowFrameCallback(void *arg)
+{
+  const char* title = "video_setWindowFrameCallback Test Window";
+  SDL_Window* window;
+  SDL_Surface *surface;
+  SDL_Surface *frame = NULL;
+  SDL_Rect rect;
+  int result;
+
+  /* Negative case: no window */
+  result = SDL_SetWindowFrameCallback(NULL, _frameCallback, &frame);
+  SDLTest_AssertPass("Call to SDL_SetWindowFrameCallback(window=NULL)");
+  SDLTest_AssertCheck(result == -1, "Validate result value; expected: -1, got: %d", result);
+  _checkInvalidWindowError();
+
+  /* Call against new test window */
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) return TEST_ABORTED;
+
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_GetWindowSurface()");
+  if (surface == NULL) {
+    _destroyVideoSuiteTestWindow(window);
+    return TEST_SKIPPED;
+  }
+
+  result = SDL_SetWindowFrameCallback(window, _frameCallback, &frame);
+  SDLTest_AssertPass("Call to SDL_SetWindowFrameCallback()");
+  SDLTest_AssertCheck(result == 0, "Validate result value; expected: 0, got: %d", result);
+
+  /* Update a single rect and check it is reported */
+  _frameCallbackCount = 0;
+  rect.x = 1;
+  rect.y = 2;
+  rect.w = 3;
+  rect.h = 4;
+  result = SDL_UpdateWindowSurfaceRects(window, &rect, 1);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurfaceRects()");
+  SDLTest_AssertCheck(result == 0, "Validate result value; expected: 0, got: %d", result);
+  SDLTest_AssertCheck(_frameCallbackCount == 1, "Validate callback count; expected: 1, got: %d", _frameCallbackCount);
+  SDLTest_AssertCheck(frame == surface, "Validate that the window surface was passed to the callback");
+  SDLTest_AssertCheck(SDL_memcmp(&_frameCallbackRect, &rect, sizeof(rect)) == 0,
+      "Validate callback rect; expected: 1,2 3x4, got: %d,%d %dx%d",
+      _frameCallbackRect.x, _frameCallbackRect.y, _frameCallbackRect.w, _frameCallbackRect.h);
+
+  /* Clear the callback and check it is no longer invoked */
+  result = SDL_SetWindowFrameCallback(window, NULL, NULL);
+  SDLTest_AssertPass("Call to SDL_SetWindowFrameCallback(callback=NULL)");
+  SDLTest_AssertCheck(result == 0, "Validate result value; expected: 0, got: %d", result);
+  result = SDL_UpdateWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurface()");
+  SDLTest_AssertCheck(_frameCallbackCount == 1, "Validate callback count; expected: 1, got: %d", _frameCallbackCount);
+
+  /* Clean up */
+  _destroyVideoSuiteTestWindow(window);
+
+  return TEST_COMPLETED;
+}
+
+
+static int _updateRectsCount;
+static SDL_Rect _updateRects[64];
+
+static void SDLCALL
+_updateRectsCallback(SDL_Window *window, SDL_Surface *frame, const SDL_Rect *rects, int numrects, void *data)
+{
+  _updateRectsCount = SDL_min(numrects, SDL_arraysize(_updateRects));
+  SDL_memcpy(_updateRects, rects, _updateRectsCount * sizeof(*rects));
+}
+
+/* Updates the rects and checks the ones passed on are disjoint, inside the
+   surface and cover the original ones, exactly if there are few enough */
+static void
+_checkUpdateRects(SDL_Window *window, SDL_Surface *surface, const SDL_Rect *rects, int numrects, SDL_bool exact)
+{
+  Uint8 *covered = (Uint8 *)SDL_calloc(surface->w, surface->h);
+  int overlaps = 0, outside = 0, missed = 0, extra = 0;
+  int i, x, y, result;
+
+  if (covered == NULL) return;
+
+  result = SDL_UpdateWindowSurfaceRects(window, rects, numrects);
+  SDLTest_AssertPass("Call to SDL_UpdateWindowSurfaceRects(numrects=%d)", numrects);
+  SDLTest_AssertCheck(result == 0, "Validate result value; expected: 0, got: %d", result);
+  SDLTest_AssertCheck(_updateRectsCount <= 16, "Validate number of rects; expected: <= 16, got: %d", _updateRectsCount);
+
+  for (i = 0; i < _updateRectsCount; i++) {
+    const SDL_Rect *r = &_updateRects[i];
+    if (r->x < 0 || r->y < 0 || r->w <= 0 || r->h <= 0 || r->x + r->w > surface->w || r->y + r->h > surface->h) {
+      outside++;
+      continue;
+    }
+    for (y = r->y; y < r->y + r->h; y++) {
+      for (x = r->x; x < r->x + r->w; x++) {
+        overlaps += (covered[y * surface->w + x] != 0);
+        covered[y * surface->w + x] = 1;
+      }
+    }
+  }
+  for (i = 0; i < numrects; i++) {
+    for (y = SDL_max(rects[i].y, 0); y < SDL_min(rects[i].y + rects[i].h, surface->h); y++) {
+      for (x = SDL_max(rects[i].x, 0); x < SDL_min(rects[i].x + rects[i].w, surface->w); x++) {
+        missed += (covered[y * surface->w + x] == 0);
+        covered[y * surface->w + x] |= 2;
+      }
+    }
+  }
+  if (exact) {
+    for (i = 0; i < surface->w * surface->h; i++) {
+      extra += (covered[i] == 1);
+    }
+  }
+  SDL_free(covered);
+
+  SDLTest_AssertCheck(outside == 0, "Validate rects are inside the surface; expected: 0 outside, got: %d", outside);
+  SDLTest_AssertCheck(overlaps == 0, "Validate rects are disjoint; expected: 0 overlapping pixels, got: %d", overlaps);
+  SDLTest_AssertCheck(missed == 0, "Validate rects cover the update; expected: 0 missed pixels, got: %d", missed);
+  SDLTest_AssertCheck(extra == 0, "Validate rects cover only the update; expected: 0 extra pixels, got: %d", extra);
+}
+
+/**
+ * @brief Tests merging of the rects passed to SDL_UpdateWindowSurfaceRects
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_UpdateWindowSurfaceRects
+ */
+int
+video_updateWindowSurfaceRects(void *arg)
+{
+  const char* title = "video_updateWindowSurfaceRects Test Window";
+  const SDL_Rect overlapping[] = { { 0, 0, 10, 10 }, { 5, 5, 10, 10 }, { 20, 0, 5, 5 }, { 25, 0, 5, 5 } };
+  const SDL_Rect repeated[] = { { 2, 2, 4, 4 }, { 2, 2, 4, 4 }, { 3, 3, 1, 1 }, { 2, 2, 4, 4 } };
+  const SDL_Rect clipped[] = { { -5, -5, 10, 10 }, { 0, 0, 0, 0 }, { 100000, 0, 10, 10 } };
+  SDL_Rect fragments[200];
+  SDL_Window* window;
+  SDL_Surface *surface;
+  int i;
+
+  window = _createVideoSuiteTestWindow(title);
+  if (window == NULL) return TEST_ABORTED;
+
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertPass("Call to SDL_GetWindowSurface()");
+  if (surface == NULL) {
+    _destroyVideoSuiteTestWindow(window);
+    return TEST_SKIPPED;
+  }
+  SDL_SetWindowFrameCallback(window, _updateRectsCallback, NULL);
+
+  /* Overlapping and touching rects are merged */
+  _checkUpdateRects(window, surface, overlapping, SDL_arraysize(overlapping), SDL_TRUE);
+  SDLTest_AssertCheck(_updateRectsCount == 4, "Validate number of rects; expected: 4, got: %d", _updateRectsCount);
+
+  /* Repeated rects become one */
+  _checkUpdateRects(window, surface, repeated, SDL_arraysize(repeated), SDL_TRUE);
+  SDLTest_AssertCheck(_updateRectsCount == 1, "Validate number of rects; expected: 1, got: %d", _updateRectsCount);
+
+  /* Rects are clipped to the surface */
+  _checkUpdateRects(window, surface, clipped, SDL_arraysize(clipped), SDL_TRUE);
+  SDLTest_AssertCheck(_updateRectsCount == 1 && _updateRects[0].w == 5 && _updateRects[0].h == 5,
+    "Validate clipped rect; expected: 0,0 5x5, got: %d,%d %dx%d",
+    _updateRects[0].x, _updateRects[0].y, _updateRects[0].w, _updateRects[0].h);
+
+  /* Lots of small rects are simplified */
+  for (i = 0; i < SDL_arraysize(fragments); i++) {
+    fragments[i].x = SDLTest_RandomIntegerInRange(-10, surface->w);
+    fragments[i].y = SDLTest_RandomIntegerInRange(-10, surface->h);
+    fragments[i].w = SDLTest_RandomIntegerInRange(1, 40);
+    fragments[i].h = SDLTest_RandomIntegerInRange(1, 40);
+  }
+  _checkUpdateRects(window, surface, fragments, SDL_arraysize(fragments), SDL_FALSE);
+
+  /* Clean up */
+  SDL_SetWindowFrameCallback(window, NULL, NULL);
+  _destroyVideoSuiteTestWindow(window);
+
+  return TEST_COMPLETED;
+}
+
+#if defined(SDL_VIDEO_DRIVER_X11)
+#include <X11/Xutil.h>
+
+typedef XImage *(*_XGetImageFunc)(Display *, Drawable, int, int, unsigned int, unsigned int, unsigned long, int);
+
+#define SHM_TEST_W  64
+#define SHM_TEST_H  48
+
+/* Counts the pixels that differ from the expected ones in the surface and, read back from the X server, in the window */
+static void
+_countShmDifferences(SDL_Window *window, SDL_Surface *surface, const Uint32 *expected,
+                     _XGetImageFunc getimage, int *surface_diffs, int *window_diffs)
+{
+  const Uint32 rgbmask = surface->format->Rmask | surface->format->Gmask | surface->format->Bmask;
+  SDL_SysWMinfo info;
+  XImage *image;
+  int x, y;
+
+  *surface_diffs = 0;
+  for (y = 0; y < SHM_TEST_H; y++) {
+    const Uint32 *row = (const Uint32 *)((const Uint8 *)surface->pixels + y * surface->pitch);
+    for (x = 0; x < SHM_TEST_W; x++) {
+      if ((row[x] & rgbmask) != (expected[y * SHM_TEST_W + x] & rgbmask)) {
+        (*surface_diffs)++;
+      }
+    }
+  }
+
+  *window_diffs = SHM_TEST_W * SHM_TEST_H;
+  SDL_VERSION(&info.version);
+  if (!SDL_GetWindowWMInfo(window, &info)) {
+    return;
+  }
+  image = getimage(info.info.x11.display, info.info.x11.window, 0, 0, SHM_TEST_W, SHM_TEST_H, AllPlanes, ZPixmap);
+  if (image == NULL) {
+    return;
+  }
+  *window_diffs = 0;
+  for (y = 0; y < SHM_TEST_H; y++) {
+    for (x = 0; x < SHM_TEST_W; x++) {
+      if (((Uint32)XGetPixel(image, x, y) & rgbmask) != (expected[y * SHM_TEST_W + x] & rgbmask)) {
+        (*window_diffs)++;
+      }
+    }
+  }
+  XDestroyImage(image);
+}
+
+/* Draws partial updates into a window surface backed by the given number of MIT-SHM images */
+static void
+_checkShmBuffers(const char *buffers, _XGetImageFunc getimage)
+{
+  const char* title = "video_x11ShmBuffers Test Window";
+  Uint32 expected[SHM_TEST_W * SHM_TEST_H];
+  void *images[8];
+  SDL_Window* window;
+  SDL_Surface *surface;
+  SDL_Rect rect;
+  Uint32 color;
+  int num_images = 0;
+  int surface_diffs, window_diffs;
+  int i, x, y;
+
+  SDL_SetHint(SDL_HINT_VIDEO_X11_SHM_BUFFERS, buffers);
+  /* XGetImage needs the whole window on the screen */
+  window = SDL_CreateWindow(title, 0, 0, SHM_TEST_W, SHM_TEST_H, SDL_WINDOW_SHOWN | SDL_WINDOW_BORDERLESS);
+  SDLTest_AssertCheck(window != NULL, "Validate that returned window struct is not NULL");
+  if (window == NULL) {
+    return;
+  }
+  surface = SDL_GetWindowSurface(window);
+  SDLTest_AssertCheck(surface != NULL && surface->format->BytesPerPixel == 4, "Validate that the window surface has 32-bit pixels");
+  if (surface == NULL || surface->format->BytesPerPixel != 4) {
+    _destroyVideoSuiteTestWindow(window);
+    return;
+  }
+
+  color = SDL_MapRGB(surface->format, 10, 20, 30);
+  SDL_FillRect(surface, NULL, color);
+  for (i = 0; i < SDL_arraysize(expected); i++) {
+    expected[i] = color;
+  }
+  images[num_images++] = surface->pixels;
+  SDL_UpdateWindowSurface(window);
+
+  /* Each image must get the areas updated while the others were current */
+  for (i = 0; i < 8; i++) {
+    int j;
+
+    rect.x = (i * 7) % (SHM_TEST_W - 16);
+    rect.y = (i * 5) % (SHM_TEST_H - 12);
+    rect.w = 16;
+    rect.h = 12;
+    color = SDL_MapRGB(surface->format, (Uint8)(i * 40), (Uint8)(255 - i * 30), (Uint8)(i * 97));
+    SDL_FillRect(surface, &rect, color);
+    for (y = rect.y; y < rect.y + rect.h; y++) {
+      for (x = rect.x; x < rect.x + rect.w; x++) {
+        expected[y * SHM_TEST_W + x] = color;
+      }
+    }
+    SDL_UpdateWindowSurfaceRects(window, &rect, 1);
+
+    surface = SDL_GetWindowSurface(window);
+    for (j = 0; j < num_images && images[j] != surface->pixels; j++) {
+    }
+    if (j == num_images && num_images < SDL_arraysize(images)) {
+      images[num_images++] = surface->pixels;
+    }
+    _countShmDifferences(window, surface, expected, getimage, &surface_diffs, &window_diffs);
+    SDLTest_AssertCheck(surface_diffs == 0, "Validate image %d after update %d with %s buffers; expected: 0 stale pixels, got: %d",
+                        j, i, buffers, surface_diffs);
+    SDLTest_AssertCheck(window_diffs == 0, "Validate window after update %d with %s buffers; expected: 0 wrong pixels, got: %d",
+                        i, buffers, window_diffs);
+  }
+  SDLTest_AssertCheck(num_images == SDL_atoi(buffers), "Validate number of images drawn to; expected: %s, got: %d",
+                      buffers, num_images);
+
+  _destroyVideoSuiteTestWindow(window);
+}
+#endif /* SDL_VIDEO_DRIVER_X11 */
+
+/**
+ * @brief Tests window surfaces backed by several MIT-SHM images with SDL_VIDEODRIVER=x11
+ *
+ * @sa http://wiki.libsdl.org/moin.fcg/SDL_UpdateWindowSurfaceRects
+ */
+int
+video_x11ShmBuffers(void *arg)
+{
+#if defined(SDL_VIDEO_DRIVER_X11)
+  const char *driver = SDL_GetCurrentVideoDriver();
+  const char *hint;
+  char *saved;
+  void *libx11;
+  _XGetImageFunc getimage;
+
+  if (driver == NULL || SDL_strcmp(driver, "x11") != 0) {
+    SDLTest_Log("Skipping test, the video driver is not x11");
+    return TEST_SKIPPED;
+  }
+
+  /* SDL loads libX11 itself, so the test doesn't link with it either */
+  libx11 = SDL_LoadObject("libX11.so.6");
+  if (libx11 == NULL) {
+    libx11 = SDL_LoadObject("libX11.so");
+  }
+  getimage = libx11 ? (_XGetImageFunc) SDL_LoadFunction(libx11, "XGetImage") : NULL;
+  SDLTest_AssertCheck(getimage != NULL, "Validate that XGetImage was loaded");
+  if (getimage == NULL) {
+    SDL_UnloadObject(libx11);
+    return TEST_ABORTED;
+  }
+
+  hint = SDL_GetHint(SDL_HINT_VIDEO_X11_SHM_BUFFERS);
+  saved = hint ? SDL_strdup(hint) : NULL;
+  _checkShmBuffers("2", getimage);
+  _checkShmBuffers("3", getimage);
+  SDL_SetHint(SDL_HINT_VIDEO_X11_SHM_BUFFERS, saved);
+  SDL_free(saved);
+  SDL_UnloadObject(libx11);
+
+  return TEST_COMPLETED;
+#else
+  SDLTest_Log("Skipping test, SDL was built without the x11 video driver");
+  return TEST_SKIPPED;
+#endif
+}
 
 /* ================= Test References ================== */
 
@@ -1793,13 +2158,22 @@ static const SDLTest_TestCaseReference videoTest22 =
 static const SDLTest_TestCaseReference videoTest23 =
         { (SDLTest_TestCaseFp)video_getSetWindowData, "video_getSetWindowData",  "Checks SDL_SetWindowData and SDL_GetWindowData positive and negative cases", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference videoTest24 =
+        { (SDLTest_TestCaseFp)video_setWindowFrameCallback, "video_setWindowFrameCallback",  "Checks SDL_SetWindowFrameCallback positive and negative cases", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference videoTest25 =
+        { (SDLTest_TestCaseFp)video_updateWindowSurfaceRects, "video_updateWindowSurfaceRects",  "Checks merging of the rects passed to SDL_UpdateWindowSurfaceRects", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference videoTest26 =
+        { (SDLTest_TestCaseFp)video_x11ShmBuffers, "video_x11ShmBuffers",  "Checks partial updates of window surfaces backed by several MIT-SHM images", TEST_ENABLED };
+
 /* Sequence of Video test cases */
 static const SDLTest_TestCaseReference *videoTests[] =  {
     &videoTest1, &videoTest2, &videoTest3, &videoTest4, &videoTest5, &videoTest6,
     &videoTest7, &videoTest8, &videoTest9, &videoTest10, &videoTest11, &videoTest12,
     &videoTest13, &videoTest14, &videoTest15, &videoTest16, &videoTest17,
     &videoTest18, &videoTest19, &videoTest20, &videoTest21, &videoTest22,
-    &videoTest23, NULL
+    &videoTest23, &videoTest24, &videoTest25, &videoTest26, NULL
 };
 
 /* Video test suite (global) */
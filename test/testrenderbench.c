@@ -0,0 +1,657 @@
+/*
+  Copyright (C) 1997-2019 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Non-interactive render throughput benchmark.
+
+   Runs a fixed set of seeded workloads against the software renderer on a
+   headless video driver and writes the results as JSON, so numbers can be
+   compared between builds:
+
+     testrenderbench [--frames N] [--warmup N] [--count N] [--seed N]
+                     [--size WxH] [--workload NAME] [--output FILE]
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+#define DEFAULT_WIDTH       640
+#define DEFAULT_HEIGHT      480
+#define DEFAULT_FRAMES      100
+#define DEFAULT_WARMUP      10
+#define DEFAULT_COUNT       1000
+#define DEFAULT_SEED        0x53444C32
+#define SPRITE_SIZE         32
+
+typedef struct
+{
+    float x, y;
+    float dx, dy;
+    double angle;
+    SDL_Color color;
+} BenchItem;
+
+typedef struct
+{
+    const char *name;
+    int (*setup)(void);
+    int (*draw)(void);
+    void (*cleanup)(void);
+    int primitives_per_frame;
+} BenchWorkload;
+
+static int width = DEFAULT_WIDTH;
+static int height = DEFAULT_HEIGHT;
+static int count = DEFAULT_COUNT;
+static Uint64 seed = DEFAULT_SEED;
+
+static SDL_Window *window;
+static SDL_Renderer *renderer;
+static SDL_Texture *sprite;
+static SDL_Texture *streaming;
+static SDL_Texture *target;
+static BenchItem *items;
+static SDL_Point *points;
+static Uint32 *pixels;
+static Uint32 frame_number;
+
+/* Allocation accounting, installed through SDL_SetMemoryFunctions() */
+static SDL_malloc_func real_malloc;
+static SDL_calloc_func real_calloc;
+static SDL_realloc_func real_realloc;
+static SDL_free_func real_free;
+static SDL_atomic_t allocations;
+static SDL_atomic_t allocated_bytes;
+
+static void * SDLCALL
+bench_malloc(size_t size)
+{
+    SDL_AtomicIncRef(&allocations);
+    SDL_AtomicAdd(&allocated_bytes, (int)size);
+    return real_malloc(size);
+}
+
+static void * SDLCALL
+bench_calloc(size_t nmemb, size_t size)
+{
+    SDL_AtomicIncRef(&allocations);
+    SDL_AtomicAdd(&allocated_bytes, (int)(nmemb * size));
+    return real_calloc(nmemb, size);
+}
+
+static void * SDLCALL
+bench_realloc(void *mem, size_t size)
+{
+    SDL_AtomicIncRef(&allocations);
+    SDL_AtomicAdd(&allocated_bytes, (int)size);
+    return real_realloc(mem, size);
+}
+
+static void SDLCALL
+bench_free(void *mem)
+{
+    real_free(mem);
+}
+
+/* Initialize the item table the same way for every run */
+static void
+InitItems(void)
+{
+    SDLTest_RandomContext rnd;
+    int i;
+
+    SDLTest_RandomInit(&rnd, (unsigned int)(seed >> 32), (unsigned int)seed);
+    for (i = 0; i < count; ++i) {
+        BenchItem *item = &items[i];
+        item->x = (float)(SDLTest_Random(&rnd) % (width - SPRITE_SIZE));
+        item->y = (float)(SDLTest_Random(&rnd) % (height - SPRITE_SIZE));
+        item->dx = (float)((int)(SDLTest_Random(&rnd) % 7) - 3);
+        item->dy = (float)((int)(SDLTest_Random(&rnd) % 7) - 3);
+        item->angle = (double)(SDLTest_Random(&rnd) % 360);
+        item->color.r = (Uint8)SDLTest_Random(&rnd);
+        item->color.g = (Uint8)SDLTest_Random(&rnd);
+        item->color.b = (Uint8)SDLTest_Random(&rnd);
+        item->color.a = (Uint8)(128 + SDLTest_Random(&rnd) % 128);
+    }
+}
+
+static void
+MoveItems(void)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        BenchItem *item = &items[i];
+        item->x += item->dx;
+        if (item->x < 0.0f || item->x >= (float)(width - SPRITE_SIZE)) {
+            item->dx = -item->dx;
+            item->x += item->dx;
+        }
+        item->y += item->dy;
+        if (item->y < 0.0f || item->y >= (float)(height - SPRITE_SIZE)) {
+            item->dy = -item->dy;
+            item->y += item->dy;
+        }
+        item->angle += 1.0;
+    }
+}
+
+static SDL_Texture *
+CreateSprite(void)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, SPRITE_SIZE, SPRITE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    /* A soft edged disc, so blending does real work on every pixel */
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            int cx = x - SPRITE_SIZE / 2;
+            int cy = y - SPRITE_SIZE / 2;
+            int d = cx * cx + cy * cy;
+            int r2 = (SPRITE_SIZE / 2) * (SPRITE_SIZE / 2);
+            Uint32 a = (d >= r2) ? 0 : (Uint32)(255 - (d * 255) / r2);
+            row[x] = (a << 24) | ((Uint32)(x * 8) << 16) | ((Uint32)(y * 8) << 8) | 0xFF;
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+    return texture;
+}
+
+static int
+DrawSprites(void)
+{
+    SDL_Rect dst;
+    int i;
+
+    dst.w = SPRITE_SIZE;
+    dst.h = SPRITE_SIZE;
+    for (i = 0; i < count; ++i) {
+        dst.x = (int)items[i].x;
+        dst.y = (int)items[i].y;
+        if (SDL_RenderCopy(renderer, sprite, NULL, &dst) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+DrawRotatedSprites(void)
+{
+    SDL_FRect dst;
+    int i;
+
+    dst.w = (float)SPRITE_SIZE;
+    dst.h = (float)SPRITE_SIZE;
+    for (i = 0; i < count; ++i) {
+        dst.x = items[i].x;
+        dst.y = items[i].y;
+        if (SDL_RenderCopyExF(renderer, sprite, NULL, &dst, items[i].angle, NULL, SDL_FLIP_NONE) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+DrawFills(void)
+{
+    SDL_Rect rect;
+    int i;
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    rect.w = SPRITE_SIZE;
+    rect.h = SPRITE_SIZE;
+    for (i = 0; i < count; ++i) {
+        const SDL_Color *c = &items[i].color;
+        rect.x = (int)items[i].x;
+        rect.y = (int)items[i].y;
+        SDL_SetRenderDrawColor(renderer, c->r, c->g, c->b, c->a);
+        if (SDL_RenderFillRect(renderer, &rect) < 0) {
+            return -1;
+        }
+    }
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    return 0;
+}
+
+static int
+DrawLines(void)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const BenchItem *a = &items[i];
+        const BenchItem *b = &items[(i + 1) % count];
+        SDL_SetRenderDrawColor(renderer, a->color.r, a->color.g, a->color.b, 0xFF);
+        if (SDL_RenderDrawLine(renderer, (int)a->x, (int)a->y, (int)b->x, (int)b->y) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int
+SetupPoints(void)
+{
+    points = (SDL_Point *)SDL_malloc(count * sizeof(*points));
+    if (!points) {
+        return SDL_OutOfMemory();
+    }
+    return 0;
+}
+
+static int
+DrawPoints(void)
+{
+    int i, j;
+
+    /* Points are cheap, so draw a small cloud around each item */
+    for (j = 0; j < 16; ++j) {
+        for (i = 0; i < count; ++i) {
+            points[i].x = (int)items[i].x + (j & 3) * 4;
+            points[i].y = (int)items[i].y + (j >> 2) * 4;
+        }
+        SDL_SetRenderDrawColor(renderer, 0xFF, (Uint8)(j * 16), 0x00, 0xFF);
+        if (SDL_RenderDrawPoints(renderer, points, count) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static void
+CleanupPoints(void)
+{
+    SDL_free(points);
+    points = NULL;
+}
+
+static int
+SetupStreaming(void)
+{
+    streaming = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (!streaming) {
+        return -1;
+    }
+    pixels = (Uint32 *)SDL_malloc(width * height * sizeof(*pixels));
+    if (!pixels) {
+        return SDL_OutOfMemory();
+    }
+    return 0;
+}
+
+static int
+DrawStreaming(void)
+{
+    void *locked;
+    int pitch;
+    int x, y;
+
+    /* One full upload through SDL_UpdateTexture() and one through locking */
+    for (y = 0; y < height; ++y) {
+        Uint32 *row = &pixels[y * width];
+        for (x = 0; x < width; ++x) {
+            row[x] = 0xFF000000 | ((x + frame_number) & 0xFF) << 16 | ((y + frame_number) & 0xFF) << 8;
+        }
+    }
+    if (SDL_UpdateTexture(streaming, NULL, pixels, width * sizeof(*pixels)) < 0) {
+        return -1;
+    }
+    if (SDL_RenderCopy(renderer, streaming, NULL, NULL) < 0) {
+        return -1;
+    }
+
+    if (SDL_LockTexture(streaming, NULL, &locked, &pitch) < 0) {
+        return -1;
+    }
+    for (y = 0; y < height; ++y) {
+        SDL_memcpy((Uint8 *)locked + y * pitch, &pixels[(height - y - 1) * width], width * sizeof(*pixels));
+    }
+    SDL_UnlockTexture(streaming);
+    return SDL_RenderCopy(renderer, streaming, NULL, NULL);
+}
+
+static void
+CleanupStreaming(void)
+{
+    SDL_DestroyTexture(streaming);
+    streaming = NULL;
+    SDL_free(pixels);
+    pixels = NULL;
+}
+
+static int
+SetupTarget(void)
+{
+    target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width / 2, height / 2);
+    if (!target) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+DrawTarget(void)
+{
+    SDL_Rect dst;
+    int i;
+
+    /* Draw into a half size target, then scale it up onto the window */
+    if (SDL_SetRenderTarget(renderer, target) < 0) {
+        return -1;
+    }
+    SDL_SetRenderDrawColor(renderer, 0x20, 0x20, 0x40, 0xFF);
+    SDL_RenderClear(renderer);
+    dst.w = SPRITE_SIZE / 2;
+    dst.h = SPRITE_SIZE / 2;
+    for (i = 0; i < count; ++i) {
+        dst.x = (int)items[i].x / 2;
+        dst.y = (int)items[i].y / 2;
+        if (SDL_RenderCopy(renderer, sprite, NULL, &dst) < 0) {
+            return -1;
+        }
+    }
+    if (SDL_SetRenderTarget(renderer, NULL) < 0) {
+        return -1;
+    }
+    return SDL_RenderCopy(renderer, target, NULL, NULL);
+}
+
+static void
+CleanupTarget(void)
+{
+    SDL_DestroyTexture(target);
+    target = NULL;
+}
+
+static BenchWorkload workloads[] = {
+    { "sprites", NULL, DrawSprites, NULL, 1 },
+    { "rotated_sprites", NULL, DrawRotatedSprites, NULL, 1 },
+    { "fills", NULL, DrawFills, NULL, 1 },
+    { "lines", NULL, DrawLines, NULL, 1 },
+    { "points", SetupPoints, DrawPoints, CleanupPoints, 16 },
+    { "streaming", SetupStreaming, DrawStreaming, CleanupStreaming, 0 },
+    { "render_target", SetupTarget, DrawTarget, CleanupTarget, 1 }
+};
+
+/* FNV-1a over the rendered frame, so a speedup that changes output shows up */
+static Uint32
+ChecksumFrame(void)
+{
+    Uint32 hash = 2166136261u;
+    Uint32 *frame;
+    int i;
+
+    frame = (Uint32 *)SDL_malloc(width * height * sizeof(*frame));
+    if (!frame) {
+        return 0;
+    }
+    if (SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_ARGB8888, frame, width * sizeof(*frame)) == 0) {
+        for (i = 0; i < width * height; ++i) {
+            hash = (hash ^ frame[i]) * 16777619u;
+        }
+    } else {
+        hash = 0;
+    }
+    SDL_free(frame);
+    return hash;
+}
+
+static int
+RunFrame(BenchWorkload *workload)
+{
+    SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xFF);
+    SDL_RenderClear(renderer);
+    if (workload->draw() < 0) {
+        return -1;
+    }
+    SDL_RenderPresent(renderer);
+    MoveItems();
+    ++frame_number;
+    return 0;
+}
+
+static int
+RunWorkload(FILE *out, BenchWorkload *workload, int warmup, int frames, SDL_bool first)
+{
+    Uint64 start, elapsed;
+    Uint64 primitives;
+    int start_allocations, start_bytes;
+    SDL_RenderStats stats;
+    double seconds, ns_per_primitive, fps;
+    Uint32 checksum;
+    int i;
+
+    if (workload->setup && workload->setup() < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up %s: %s\n", workload->name, SDL_GetError());
+        return -1;
+    }
+
+    InitItems();
+    frame_number = 0;
+    for (i = 0; i < warmup; ++i) {
+        if (RunFrame(workload) < 0) {
+            goto failed;
+        }
+    }
+
+    start_allocations = SDL_AtomicGet(&allocations);
+    start_bytes = SDL_AtomicGet(&allocated_bytes);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < frames; ++i) {
+        if (RunFrame(workload) < 0) {
+            goto failed;
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    SDL_RenderGetStats(renderer, &stats);
+
+    /* Render one more frame without presenting it to check the output */
+    SDL_SetRenderDrawColor(renderer, 0x00, 0x00, 0x00, 0xFF);
+    SDL_RenderClear(renderer);
+    InitItems();
+    frame_number = 0;
+    if (workload->draw() < 0) {
+        goto failed;
+    }
+    checksum = ChecksumFrame();
+
+    if (workload->cleanup) {
+        workload->cleanup();
+    }
+
+    seconds = (double)elapsed / (double)SDL_GetPerformanceFrequency();
+    primitives = (Uint64)workload->primitives_per_frame * count * frames;
+    if (primitives == 0) {
+        /* Streaming uploads are measured per texel */
+        primitives = (Uint64)width * height * 2 * frames;
+    }
+    ns_per_primitive = (seconds * 1e9) / (double)primitives;
+    fps = seconds > 0.0 ? (double)frames / seconds : 0.0;
+
+    fprintf(out, "%s\n    {\n", first ? "" : ",");
+    fprintf(out, "      \"name\": \"%s\",\n", workload->name);
+    fprintf(out, "      \"frames\": %d,\n", frames);
+    fprintf(out, "      \"primitives\": %" SDL_PRIu64 ",\n", primitives);
+    fprintf(out, "      \"seconds\": %.6f,\n", seconds);
+    fprintf(out, "      \"ns_per_primitive\": %.3f,\n", ns_per_primitive);
+    fprintf(out, "      \"fps\": %.2f,\n", fps);
+    fprintf(out, "      \"allocations\": %d,\n", SDL_AtomicGet(&allocations) - start_allocations);
+    fprintf(out, "      \"allocated_bytes\": %d,\n", SDL_AtomicGet(&allocated_bytes) - start_bytes);
+    fprintf(out, "      \"commands_executed_per_frame\": %u,\n", stats.commands_executed);
+    fprintf(out, "      \"flushes_per_frame\": %u,\n", stats.flushes);
+    fprintf(out, "      \"checksum\": \"%08x\"\n", checksum);
+    fprintf(out, "    }");
+    return 0;
+
+failed:
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s failed: %s\n", workload->name, SDL_GetError());
+    if (workload->cleanup) {
+        workload->cleanup();
+    }
+    return -1;
+}
+
+static int
+InitVideo(void)
+{
+    /* Prefer the offscreen driver, but honor SDL_VIDEODRIVER if it was set */
+    if (SDL_getenv("SDL_VIDEODRIVER")) {
+        return SDL_Init(SDL_INIT_VIDEO);
+    }
+    SDL_setenv("SDL_VIDEODRIVER", "offscreen", 1);
+    if (SDL_Init(SDL_INIT_VIDEO) == 0) {
+        return 0;
+    }
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    return SDL_Init(SDL_INIT_VIDEO);
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *only = NULL;
+    const char *output = NULL;
+    int frames = DEFAULT_FRAMES;
+    int warmup = DEFAULT_WARMUP;
+    FILE *out = stdout;
+    SDL_bool first = SDL_TRUE;
+    int result = 0;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (SDL_strcmp(arg, "--frames") == 0 && value) {
+            frames = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--warmup") == 0 && value) {
+            warmup = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--count") == 0 && value) {
+            count = SDL_atoi(value);
+        } else if (SDL_strcmp(arg, "--seed") == 0 && value) {
+            seed = SDL_strtoull(value, NULL, 0);
+        } else if (SDL_strcmp(arg, "--size") == 0 && value) {
+            if (SDL_sscanf(value, "%dx%d", &width, &height) != 2) {
+                width = height = 0;
+            }
+        } else if (SDL_strcmp(arg, "--workload") == 0 && value) {
+            only = value;
+        } else if (SDL_strcmp(arg, "--output") == 0 && value) {
+            output = value;
+        } else {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--frames N] [--warmup N] [--count N] [--seed N] [--size WxH] [--workload NAME] [--output FILE]\n", argv[0]);
+            return 1;
+        }
+        ++i;
+    }
+    if (frames <= 0 || warmup < 0 || count <= 0 || width <= SPRITE_SIZE || height <= SPRITE_SIZE) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Invalid benchmark parameters\n");
+        return 1;
+    }
+    if (only) {
+        for (i = 0; i < SDL_arraysize(workloads); ++i) {
+            if (SDL_strcmp(only, workloads[i].name) == 0) {
+                break;
+            }
+        }
+        if (i == SDL_arraysize(workloads)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Unknown workload: %s\n", only);
+            return 1;
+        }
+    }
+
+    SDL_GetMemoryFunctions(&real_malloc, &real_calloc, &real_realloc, &real_free);
+    SDL_SetMemoryFunctions(bench_malloc, bench_calloc, bench_realloc, bench_free);
+
+    if (InitVideo() < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize video: %s\n", SDL_GetError());
+        return 2;
+    }
+
+    window = SDL_CreateWindow("testrenderbench", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, width, height, 0);
+    if (window) {
+        renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+    }
+    if (!renderer) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create software renderer: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 2;
+    }
+    sprite = CreateSprite();
+    items = (BenchItem *)SDL_malloc(count * sizeof(*items));
+    if (!sprite || !items) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create benchmark data: %s\n", SDL_GetError());
+        SDL_Quit();
+        return 2;
+    }
+
+    if (output) {
+        out = fopen(output, "w");
+        if (!out) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s for writing\n", output);
+            SDL_Quit();
+            return 2;
+        }
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"video_driver\": \"%s\",\n", SDL_GetCurrentVideoDriver());
+    fprintf(out, "  \"renderer\": \"software\",\n");
+    fprintf(out, "  \"platform\": \"%s\",\n", SDL_GetPlatform());
+    fprintf(out, "  \"cpu_count\": %d,\n", SDL_GetCPUCount());
+    fprintf(out, "  \"width\": %d,\n", width);
+    fprintf(out, "  \"height\": %d,\n", height);
+    fprintf(out, "  \"count\": %d,\n", count);
+    fprintf(out, "  \"seed\": %" SDL_PRIu64 ",\n", seed);
+    fprintf(out, "  \"workloads\": [");
+    for (i = 0; i < SDL_arraysize(workloads); ++i) {
+        if (only && SDL_strcmp(only, workloads[i].name) != 0) {
+            continue;
+        }
+        if (RunWorkload(out, &workloads[i], warmup, frames, first) < 0) {
+            result = 3;
+            break;
+        }
+        first = SDL_FALSE;
+    }
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout) {
+        fclose(out);
+    }
+
+    SDL_free(items);
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return result;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */